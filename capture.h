@@ -0,0 +1,242 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <google/protobuf/message_lite.h>
+
+#include "storage.h"
+
+/*
+ * Traffic capture of a master, replayed against another server by tsreplay.
+ *
+ * Every RPC the master handles is recorded once it has been answered: the
+ * request, when it arrived (nanoseconds since the capture started) and how
+ * long the master took. Timeline streams are recorded message by message,
+ * under an id per stream, followed by an end record when the stream closes,
+ * so a replay can open the same streams and keep them as concurrent as they
+ * were. All integers are little endian:
+ *
+ *     file header    magic "TSCAPTR1", wall clock time of the start (ns)
+ *     record         payload length (4), kind (4), stream id (8, 0 for unary
+ *                    calls), arrival (8), handling time (8), then the request
+ *                    (Request, TimelineRequest or Message) as protobuf
+ *
+ * Handlers only encode the record and append it to a buffer; a writer thread
+ * writes the buffer out every CAPTURE_FLUSH_MS, or sooner once it holds
+ * CAPTURE_FLUSH_BYTES. Records arriving while CAPTURE_MAX_PENDING bytes are
+ * waiting (the disk cannot keep up) are dropped rather than slowing the
+ * master down.
+ */
+
+#define CAPTURE_MAGIC 0x3152545041435354ULL	// "TSCAPTR1"
+#define CAPTURE_FILE_HEADER_SIZE 16
+#define CAPTURE_RECORD_HEADER_SIZE 32
+#define CAPTURE_FLUSH_MS 10
+#define CAPTURE_FLUSH_BYTES (256 * 1024)
+#define CAPTURE_MAX_PENDING (64 * 1024 * 1024)
+
+enum CaptureKind
+{
+	CAPTURE_LOGIN = 1,
+	CAPTURE_FOLLOW,
+	CAPTURE_UNFOLLOW,
+	CAPTURE_LIST,
+	CAPTURE_GET_TIMELINE,
+	CAPTURE_STREAM_MESSAGE,		// A message read from a Timeline stream
+	CAPTURE_STREAM_END		// The client closed the stream (no payload)
+};
+
+inline void putLittleEndian(char *out, uint64_t value, int bytes)
+{
+	for (int i = 0; i < bytes; i++)
+		out[i] = (char) ((value >> (8 * i)) & 0xff);
+}
+
+inline uint64_t getLittleEndian(const char *in, int bytes)
+{
+	uint64_t value = 0;
+	for (int i = 0; i < bytes; i++)
+		value |= (uint64_t) (unsigned char) in[i] << (8 * i);
+	return value;
+}
+
+// Writer side, used by the master
+class CaptureWriter
+{
+	public:
+		~CaptureWriter()
+		{
+			if (writer.joinable())
+			{
+				{
+					std::lock_guard<std::mutex> lock(mtx);
+					stopping = true;
+				}
+				cv.notify_one();
+				writer.join();
+			}
+		}
+
+		// Start a new capture in the file and the thread writing it out
+		bool open(const std::string &path)
+		{
+			if ((fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)) < 0)
+				return false;
+			start = std::chrono::steady_clock::now();
+			char header[CAPTURE_FILE_HEADER_SIZE];
+			putLittleEndian(header, CAPTURE_MAGIC, 8);
+			putLittleEndian(header + 8, std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count(), 8);
+			if (!writeAll(fd, header, sizeof(header)))
+				return false;
+			writer = std::thread(&CaptureWriter::run, this);
+			capturing = true;
+			return true;
+		}
+
+		bool enabled() const { return capturing; }
+
+		// Nanoseconds since the capture started
+		int64_t now() const
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		// Queue a record for the writer thread (payload may be NULL)
+		void record(CaptureKind kind, uint64_t stream, int64_t arrival_ns, int64_t handling_ns,
+					const google::protobuf::MessageLite *payload)
+		{
+			std::string record(CAPTURE_RECORD_HEADER_SIZE, '\0');
+			if (payload != NULL)
+				payload->AppendToString(&record);
+			putLittleEndian(&record[0], record.size() - CAPTURE_RECORD_HEADER_SIZE, 4);
+			putLittleEndian(&record[4], kind, 4);
+			putLittleEndian(&record[8], stream, 8);
+			putLittleEndian(&record[16], arrival_ns, 8);
+			putLittleEndian(&record[24], handling_ns, 8);
+
+			std::lock_guard<std::mutex> lock(mtx);
+			if (pending.size() + record.size() > CAPTURE_MAX_PENDING)
+			{
+				if (dropped++ == 0)
+					std::cerr << "Capture cannot keep up, dropping records" << std::endl;
+				return;
+			}
+			pending += record;
+			if (pending.size() >= CAPTURE_FLUSH_BYTES)
+				cv.notify_one();
+		}
+
+	private:
+		void run()
+		{
+			std::string writing;
+			std::unique_lock<std::mutex> lock(mtx);
+			while (!stopping || !pending.empty())
+			{
+				cv.wait_for(lock, std::chrono::milliseconds(CAPTURE_FLUSH_MS),
+					[this]() { return stopping || pending.size() >= CAPTURE_FLUSH_BYTES; });
+				writing.swap(pending);
+				lock.unlock();
+				if (!writing.empty() && !writeAll(fd, writing.data(), writing.size()))
+					std::cerr << "Capture write failed" << std::endl;
+				writing.clear();
+				lock.lock();
+			}
+		}
+
+		int fd = -1;
+		bool capturing = false;
+		std::chrono::steady_clock::time_point start;
+
+		std::mutex mtx;
+		std::condition_variable cv;
+		std::string pending;
+		uint64_t dropped = 0;
+		bool stopping = false;
+		std::thread writer;
+};
+
+// Records a request when it goes out of scope, with the time it took to handle
+class CaptureScope
+{
+	public:
+		CaptureScope(CaptureWriter &capture, CaptureKind kind, uint64_t stream, const google::protobuf::MessageLite &payload)
+			: capture(capture), kind(kind), stream(stream), payload(payload), arrival(capture.enabled() ? capture.now() : 0) {}
+		~CaptureScope()
+		{
+			if (capture.enabled())
+				capture.record(kind, stream, arrival, capture.now() - arrival, &payload);
+		}
+
+	private:
+		CaptureWriter &capture;
+		CaptureKind kind;
+		uint64_t stream;
+		const google::protobuf::MessageLite &payload;
+		int64_t arrival;
+};
+
+struct CaptureRecord
+{
+	CaptureKind kind;
+	uint64_t stream;
+	int64_t arrival_ns;
+	int64_t handling_ns;
+	std::string payload;
+};
+
+// Reader side, used by tsreplay
+class CaptureReader
+{
+	public:
+		~CaptureReader()
+		{
+			if (file != NULL)
+				fclose(file);
+		}
+
+		// Open a capture, false if it is missing or not a capture
+		bool open(const std::string &path)
+		{
+			char header[CAPTURE_FILE_HEADER_SIZE];
+			if ((file = fopen(path.c_str(), "rb")) == NULL || fread(header, 1, sizeof(header), file) != sizeof(header)
+					|| getLittleEndian(header, 8) != CAPTURE_MAGIC)
+				return false;
+			start_wall_ns = getLittleEndian(header + 8, 8);
+			return true;
+		}
+
+		// The next record, false at the end of the capture (a record cut short by the master exiting is dropped)
+		bool next(CaptureRecord &record)
+		{
+			char header[CAPTURE_RECORD_HEADER_SIZE];
+			if (fread(header, 1, sizeof(header), file) != sizeof(header))
+				return false;
+			record.payload.resize(getLittleEndian(header, 4));
+			record.kind = (CaptureKind) getLittleEndian(header + 4, 4);
+			record.stream = getLittleEndian(header + 8, 8);
+			record.arrival_ns = getLittleEndian(header + 16, 8);
+			record.handling_ns = getLittleEndian(header + 24, 8);
+			return fread(&record.payload[0], 1, record.payload.size(), file) == record.payload.size();
+		}
+
+		// Wall clock time the capture started (ns)
+		int64_t started() const { return start_wall_ns; }
+
+	private:
+		FILE *file = NULL;
+		int64_t start_wall_ns = 0;
+};
+
+#endif
@@ -0,0 +1,625 @@
+#ifndef COMPACTION_H
+#define COMPACTION_H
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "feedio.h"
+#include "log.h"
+#include "metrics.h"
+#include "ratelimit.h"
+#include "storage.h"
+
+/*
+ * Retention of the timeline files of a master (tsdm).
+ *
+ * Feeds only grow, so without retention a long running master's disk usage
+ * grows with every post. A compaction thread goes over the feeds in the
+ * working directory every COMPACT_INTERVAL_MS and trims the oldest posts of
+ * each one holding more than the policy allows: more than max_posts posts,
+ * or posts older than max_age seconds. A feed is only rewritten once at
+ * least COMPACT_MIN_DROP posts, and a quarter as many as it keeps, are due,
+ * so the posts kept are not copied over and over.
+ *
+ * The posts kept (and their index entries) are copied to the side without
+ * any lock, while appends go on; then, holding the feed's lock, the thread
+ * copies what was appended since and renames the copies over the feed and
+ * its index. Post ids stay the same: the index starts at the id of the
+ * first post kept. All reads and writes of the thread are paced to the
+ * configured bandwidth (in bytes per second, read plus written), so
+ * compaction never competes with the RPC threads for the disk.
+ *
+ * With a cold tier, the thread also moves the older posts of each following
+ * feed (all but the newest hot_posts) to the feed's cold tier (storage.h),
+ * COLD_BLOCK_POSTS at a time, each block compressed at the configured zlib
+ * level. The posts moved are dropped from the feed the same way, so posting
+ * is not slowed down: appends only ever go to the hot feed. Retention drops
+ * whole cold blocks, the oldest first, once all their posts are due.
+ *
+ * The master must own the feeds in its directory: the io_uring backend of
+ * another process keeps writing to the feeds it has open. A master handing
+ * over in a hot restart stops compacting first, and the one taking over only
+ * starts once the old one has drained.
+ */
+
+#define COMPACT_INTERVAL_MS 10000
+#define COMPACT_MIN_DROP 64
+#define COMPACT_CHUNK (64 * 1024)
+#define COMPACT_SUFFIX ".compact"
+
+extern Counter compaction_feeds;
+extern Counter compaction_posts;
+extern Counter compaction_io;
+extern Counter compaction_reclaimed;
+extern Counter cold_posts;
+extern Counter cold_raw_bytes;
+extern Counter cold_compressed_bytes;
+
+struct RetentionPolicy
+{
+	uint64_t max_posts = 0;		// Posts kept per feed (0 for no limit)
+	int64_t max_age_s = 0;		// Age of the oldest post kept, in seconds (0 for no limit)
+
+	bool enabled() const { return max_posts > 0 || max_age_s > 0; }
+};
+
+struct TierPolicy
+{
+	uint64_t hot_posts = 0;		// Newest posts of a following feed left uncompressed (0 for no cold tier)
+	int level = 6;				// zlib level of the cold blocks, 0 (stored) to 9 (smallest)
+
+	bool enabled() const { return hot_posts > 0; }
+};
+
+// Spaces out I/O to a number of bytes per second (0 for as fast as possible)
+class IoPacer
+{
+	public:
+		explicit IoPacer(double bytes_per_sec) : ns_per_byte(bytes_per_sec > 0 ? 1e9 / bytes_per_sec : 0) {}
+
+		// Account for bytes just read or written, sleeping until the rate allows the next ones
+		void spend(size_t bytes)
+		{
+			compaction_io.add(bytes);
+			if (ns_per_byte == 0)
+				return;
+			int64_t now = monotonicNanos();
+			next_ns = std::max(next_ns, now) + (int64_t) (bytes * ns_per_byte);
+			if (next_ns > now)
+				std::this_thread::sleep_for(std::chrono::nanoseconds(next_ns - now));
+		}
+
+	private:
+		double ns_per_byte;
+		int64_t next_ns = 0;
+};
+
+// Reads a feed's records in order, COMPACT_CHUNK bytes at a time
+class RecordScanner
+{
+	public:
+		RecordScanner(int fd, off_t offset, off_t end, IoPacer &pacer) : fd(fd), pos(offset), end(end), pacer(pacer) {}
+
+		// The next record's offset and payload, false at the end (or at a record still being written)
+		bool next(off_t &offset, const char *&payload, uint32_t &len)
+		{
+			if (!fill(RECORD_HEADER_SIZE))
+				return false;
+			len = recordLength(&buf[pos - buf_start]);
+			if (!fill(RECORD_HEADER_SIZE + len))
+				return false;
+			offset = pos;
+			payload = &buf[pos - buf_start + RECORD_HEADER_SIZE];
+			pos += RECORD_HEADER_SIZE + len;
+			return true;
+		}
+
+		// Offset of the next record
+		off_t position() const { return pos; }
+
+	private:
+		// Have bytes [pos, pos + need) in the buffer
+		bool fill(size_t need)
+		{
+			if (pos >= buf_start && pos + (off_t) need <= buf_start + (off_t) buf.size())
+				return true;
+			if (pos + (off_t) need > end)
+				return false;
+			buf.resize(std::min<off_t>(std::max<size_t>(need, COMPACT_CHUNK), end - pos));
+			ssize_t n = pread(fd, &buf[0], buf.size(), pos);
+			buf_start = pos;
+			if (n < (ssize_t) need)
+			{
+				buf.clear();
+				return false;
+			}
+			buf.resize(n);
+			pacer.spend(n);
+			return true;
+		}
+
+		int fd;
+		off_t pos, end;
+		IoPacer &pacer;
+		std::string buf;
+		off_t buf_start = 0;
+};
+
+class Compactor
+{
+	public:
+		~Compactor() { stop(); }
+
+		// Start the thread, with its first pass after delay_ms plus an interval
+		void start(const RetentionPolicy &retention, const TierPolicy &tiering, double bytes_per_sec, int delay_ms)
+		{
+			policy = retention;
+			tier = tiering;
+			pacer = IoPacer(bytes_per_sec);
+			worker = std::thread(&Compactor::run, this, delay_ms);
+		}
+
+		// Stop once the feed being trimmed (if any) is done
+		void stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+				stopping = true;
+			}
+			cv.notify_one();
+			if (worker.joinable())
+				worker.join();
+		}
+
+		// Trim every feed in the working directory that is due (one pass of the thread)
+		void pass()
+		{
+			DIR *dir = opendir(".");
+			if (dir == NULL)
+				return;
+			std::vector<std::string> feeds;
+			while (struct dirent *entry = readdir(dir))
+			{
+				std::string name = entry->d_name;
+				if (name.size() > 4 && name.compare(name.size() - 4, 4, ".dat") == 0)
+					feeds.push_back(name);
+			}
+			closedir(dir);
+			for (const std::string &feed : feeds)
+			{
+				if (isStopping())
+					return;
+				compactFeed(feed);
+			}
+		}
+
+		// Trim a feed (or move its older posts to the cold tier) if enough of it is due, false if it was
+		// left as it is
+		bool compactFeed(const std::string &path)
+		{
+			std::string idx_path = feedIndexPath(path);
+			bool indexed = access(idx_path.c_str(), F_OK) == 0;
+			int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+			int idx = indexed ? open(idx_path.c_str(), O_RDONLY | O_CLOEXEC) : -1;
+			struct stat st, idx_st;
+			char header[INDEX_HEADER_SIZE];
+			bool ok = fd >= 0 && fstat(fd, &st) == 0 && (!indexed || (idx >= 0 && fstat(idx, &idx_st) == 0
+				&& pread(idx, header, INDEX_HEADER_SIZE, 0) == INDEX_HEADER_SIZE));
+			if (ok)
+				ok = trim(path, fd, st, indexed ? idx : -1, indexed ? idx_st.st_size : 0, indexed ? decodeU64(header) : 0);
+			if (fd >= 0)
+				close(fd);
+			if (idx >= 0)
+				close(idx);
+			return ok;
+		}
+
+	private:
+		// Records counted so far in a feed without an index
+		struct Counted
+		{
+			ino_t ino;
+			off_t offset;
+			uint64_t records;
+		};
+
+		void run(int delay_ms)
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			int64_t wait_ms = delay_ms + COMPACT_INTERVAL_MS;
+			while (!cv.wait_for(lock, std::chrono::milliseconds(wait_ms), [this]() { return stopping; }))
+			{
+				lock.unlock();
+				pass();
+				lock.lock();
+				wait_ms = COMPACT_INTERVAL_MS;
+			}
+		}
+
+		bool isStopping()
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			return stopping;
+		}
+
+		// Trim the feed open as fd (its index open as idx, -1 if it has none)
+		bool trim(const std::string &path, int fd, const struct stat &st, int idx, off_t idx_size, uint64_t base_id)
+		{
+			// (only following feeds, always indexed, are read back and have a cold tier)
+			bool tiered = idx >= 0 && path.size() > 13 && path.compare(path.size() - 13, 13, "following.dat") == 0;
+
+			// Records in the feed, from the index or by counting the ones appended since the last pass
+			uint64_t records;
+			if (idx >= 0)
+				records = (idx_size - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE;
+			else
+			{
+				Counted &counted = counted_feeds[path];
+				if (counted.ino != st.st_ino || counted.offset > st.st_size)
+					counted = Counted{st.st_ino, 0, 0};
+				RecordScanner scanner(fd, counted.offset, st.st_size, pacer);
+				off_t offset;
+				const char *payload;
+				uint32_t len;
+				while (scanner.next(offset, payload, len))
+					counted.records++;
+				counted.offset = scanner.position();
+				records = counted.records;
+			}
+
+			// Cold blocks over the policy first; posts of the feed already in the cold tier (moved by a
+			// pass that stopped before the feed was swapped) are dropped from it
+			uint64_t cold_end = tiered ? trimCold(path, base_id, records) : 0;
+			uint64_t skip = cold_end > base_id ? std::min(cold_end - base_id, records) : 0;
+
+			// Posts over the count, then the posts after them that are over the age
+			uint64_t drop = policy.max_posts > 0 && records > policy.max_posts ? records - policy.max_posts : 0;
+			off_t cut = 0;
+			if (policy.max_age_s == 0 && !due(records, drop) && skip <= drop
+					&& (!tiered || coldBlocksDue(records, drop) == 0))
+				return false;
+			// (i is the position of the scanner's next record)
+			uint64_t i = 0;
+			if (idx >= 0)
+			{
+				if (drop > 0 && !readEntry(idx, drop, cut))
+					return false;
+				i = drop;
+			}
+			RecordScanner scanner(fd, cut, st.st_size, pacer);
+			off_t offset;
+			const char *payload;
+			uint32_t len;
+			for (; i < drop && scanner.next(offset, payload, len); i++)
+				cut = scanner.position();
+			if (i < drop)
+				return false;
+			int64_t expired_before = (int64_t) time(NULL) - policy.max_age_s;
+			for (; policy.max_age_s > 0 && i < records && scanner.next(offset, payload, len); i++)
+			{
+				csce438::Message post;
+				if (!post.ParseFromArray(payload, len) || post.timestamp().seconds() >= expired_before)
+					break;
+				drop = i + 1;
+				cut = scanner.position();
+			}
+
+			// Move blocks of the older posts kept to the cold tier, then drop them from the feed with the expired ones
+			uint64_t expired = drop, moved = std::max(drop, skip);
+			int64_t cold_bytes = 0;
+			uint64_t blocks = tiered ? coldBlocksDue(records, moved) : 0;
+			if (blocks > 0)
+				moved += demote(path, fd, idx, base_id, moved, blocks, cold_bytes) * COLD_BLOCK_POSTS;
+			if (!due(records, expired) && moved == expired)
+				return false;
+			if (moved > drop)
+			{
+				drop = moved;
+				if (drop == records)
+					cut = st.st_size;
+				else if (!readEntry(idx, drop, cut))
+					return false;
+			}
+
+			// Copy the posts kept, and their index entries (shifted to the new offsets), to the side
+			std::string tmp_path = path + COMPACT_SUFFIX, tmp_idx_path = feedIndexPath(path) + COMPACT_SUFFIX;
+			int out = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+			int idx_out = idx >= 0 ? open(tmp_idx_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644) : -1;
+			bool ok = out >= 0 && (idx < 0 || idx_out >= 0) && copyRange(fd, out, cut, st.st_size, true);
+			if (ok && idx >= 0)
+			{
+				char header[INDEX_HEADER_SIZE];
+				encodeU64(header, base_id + drop);
+				ok = writeAll(idx_out, header, INDEX_HEADER_SIZE)
+					&& copyEntries(idx, idx_out, drop, records, cut, true);
+			}
+
+			// Then what was appended meanwhile, and swap the copies in while appenders wait for the lock
+			// (appenders reopen a feed replaced while they waited for its lock; the io_uring backend checks
+			// its open descriptors once it has the lock, and drops them here)
+			if (ok)
+			{
+				std::lock_guard<std::mutex> lock(feedMutex());
+				int live = openLockedFeed(path, O_RDONLY, LOCK_EX);
+				struct stat live_st, live_idx_st;
+				// (a feed replaced by someone else meanwhile is left for the next pass)
+				ok = live >= 0 && fstat(live, &live_st) == 0 && live_st.st_ino == st.st_ino
+					&& copyRange(live, out, st.st_size, live_st.st_size, false);
+				if (ok && idx >= 0)
+				{
+					int live_idx = open(feedIndexPath(path).c_str(), O_RDONLY | O_CLOEXEC);
+					ok = live_idx >= 0 && fstat(live_idx, &live_idx_st) == 0
+						&& copyEntries(live_idx, idx_out, records, (live_idx_st.st_size - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE, cut, false)
+						&& rename(tmp_idx_path.c_str(), feedIndexPath(path).c_str()) == 0;
+					if (live_idx >= 0)
+						close(live_idx);
+				}
+				ok = ok && rename(tmp_path.c_str(), path.c_str()) == 0;
+				if (ok)
+				{
+					feedBackend()->closeFeeds();
+					if (idx < 0)
+					{
+						struct stat new_st;
+						if (stat(path.c_str(), &new_st) == 0)
+							counted_feeds[path] = Counted{new_st.st_ino, 0, 0};
+					}
+				}
+				if (live >= 0)
+					close(live);
+			}
+			if (out >= 0)
+				close(out);
+			if (idx_out >= 0)
+				close(idx_out);
+			if (!ok)
+			{
+				unlink(tmp_path.c_str());
+				unlink(tmp_idx_path.c_str());
+				return false;
+			}
+
+			compaction_feeds.add();
+			compaction_posts.add(expired);
+			compaction_reclaimed.add(std::max<int64_t>(0, cut + (idx >= 0 ? drop * INDEX_ENTRY_SIZE : 0) - cold_bytes));
+			LOG(LOG_INFO, "feed_compacted", "feed=%s dropped=%llu demoted=%llu kept=%llu reclaimed_bytes=%lld", path.c_str(),
+				(unsigned long long) expired, (unsigned long long) (drop - expired), (unsigned long long) (records - drop),
+				(long long) (cut - cold_bytes));
+			return true;
+		}
+
+		// Whether dropping posts of a feed is worth rewriting it
+		static bool due(uint64_t records, uint64_t drop)
+		{
+			return drop >= std::max<uint64_t>(COMPACT_MIN_DROP, (records - drop) / 4);
+		}
+
+		// Whole blocks of posts from position start on that are not among the hot_posts newest
+		uint64_t coldBlocksDue(uint64_t records, uint64_t start)
+		{
+			if (!tier.enabled() || records < start + tier.hot_posts)
+				return 0;
+			return (records - start - tier.hot_posts) / COLD_BLOCK_POSTS;
+		}
+
+		// Append blocks of posts from position start of a feed to its cold tier (the data before the
+		// block index entry, so readers only ever see complete blocks); returns the blocks appended and
+		// adds the bytes written to cold_bytes
+		uint64_t demote(const std::string &path, int fd, int idx, uint64_t base_id, uint64_t start, uint64_t blocks,
+						int64_t &cold_bytes)
+		{
+			int cold = open(coldPath(path).c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+			int cdx = open(coldIndexPath(path).c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+			struct stat cold_st;
+			uint64_t done = 0;
+			if (cold >= 0 && cdx >= 0 && fstat(cold, &cold_st) == 0)
+			{
+				off_t cold_size = cold_st.st_size;
+				std::string raw, compressed;
+				for (; done < blocks && !isStopping(); done++)
+				{
+					uint64_t first = start + done * COLD_BLOCK_POSTS;
+					off_t from, to;
+					if (!readEntry(idx, first, from) || !readEntry(idx, first + COLD_BLOCK_POSTS, to) || to <= from)
+						break;
+					raw.resize(to - from);
+					if (pread(fd, &raw[0], raw.size(), from) != (ssize_t) raw.size())
+						break;
+					pacer.spend(raw.size());
+
+					ColdBlock block = {base_id + first, (uint64_t) cold_size, 0, 0, (uint32_t) raw.size(), COLD_BLOCK_POSTS,
+						COLD_CODEC_ZLIB};
+					for (size_t pos = 0; pos + RECORD_HEADER_SIZE <= raw.size(); )
+					{
+						uint32_t len = recordLength(&raw[pos]);
+						csce438::Message post;
+						if (pos + RECORD_HEADER_SIZE + len <= raw.size() && post.ParseFromArray(&raw[pos + RECORD_HEADER_SIZE], len))
+							block.newest_seconds = std::max<int64_t>(block.newest_seconds, post.timestamp().seconds());
+						pos += RECORD_HEADER_SIZE + len;
+					}
+					if (!compressColdBlock(raw.data(), raw.size(), tier.level, compressed))
+						break;
+					size_t len = compressed.size();
+					block.compressed_len = len;
+					char entry[COLD_ENTRY_SIZE];
+					encodeColdBlock(entry, block);
+					if (!writeAll(cold, compressed.data(), len) || !writeAll(cdx, entry, COLD_ENTRY_SIZE))
+						break;
+					pacer.spend(len + COLD_ENTRY_SIZE);
+					cold_size += len;
+					cold_bytes += len + COLD_ENTRY_SIZE;
+					cold_posts.add(COLD_BLOCK_POSTS);
+					cold_raw_bytes.add(raw.size());
+					cold_compressed_bytes.add(len);
+				}
+			}
+			if (cold >= 0)
+				close(cold);
+			if (cdx >= 0)
+				close(cdx);
+			return done;
+		}
+
+		// Drop the oldest cold blocks of a feed whose posts are all over the retention policy; returns the
+		// id following the newest post moved to the cold tier (0 if it has none)
+		uint64_t trimCold(const std::string &path, uint64_t base_id, uint64_t records)
+		{
+			std::string cold_path = coldPath(path), cdx_path = coldIndexPath(path);
+			int cdx = open(cdx_path.c_str(), O_RDONLY | O_CLOEXEC);
+			int cold = cdx >= 0 ? open(cold_path.c_str(), O_RDONLY | O_CLOEXEC) : -1;
+			struct stat cdx_st, cold_st;
+			ColdBlock block;
+			uint64_t blocks = 0, cold_end = 0;
+			if (cold >= 0 && fstat(cdx, &cdx_st) == 0 && fstat(cold, &cold_st) == 0)
+				blocks = cdx_st.st_size / COLD_ENTRY_SIZE;
+			if (blocks > 0 && readColdBlock(cdx, blocks - 1, block))
+				cold_end = block.first_id + block.posts;
+
+			// The blocks over the count, then the ones after them over the age
+			uint64_t first_kept = policy.max_posts > 0 && base_id + records > policy.max_posts ? base_id + records - policy.max_posts : 0;
+			int64_t expired_before = (int64_t) time(NULL) - policy.max_age_s;
+			uint64_t drop = 0, dropped_posts = 0;
+			while (cold_end > 0 && policy.enabled() && drop < blocks && readColdBlock(cdx, drop, block)
+					&& (block.first_id + block.posts <= first_kept || (policy.max_age_s > 0 && block.newest_seconds < expired_before)))
+			{
+				dropped_posts += block.posts;
+				drop++;
+			}
+
+			// Copy the blocks kept, and their entries (shifted to the new offsets), to the side, then swap
+			// them in while readers wait for the feed's lock (no one else writes to the cold tier)
+			if (drop > 0)
+			{
+				std::string tmp_path = cold_path + COMPACT_SUFFIX, tmp_cdx_path = cdx_path + COMPACT_SUFFIX;
+				int out = -1, cdx_out = -1;
+				off_t cut = cold_st.st_size;
+				bool ok = true;
+				if (drop < blocks)
+				{
+					out = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+					cdx_out = open(tmp_cdx_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+					ok = out >= 0 && cdx_out >= 0 && readColdBlock(cdx, drop, block);
+					cut = block.offset;
+					ok = ok && copyRange(cold, out, cut, cold_st.st_size, true);
+					for (uint64_t n = drop; ok && n < blocks; n++)
+					{
+						char entry[COLD_ENTRY_SIZE];
+						ok = readColdBlock(cdx, n, block);
+						block.offset -= cut;
+						encodeColdBlock(entry, block);
+						ok = ok && writeAll(cdx_out, entry, COLD_ENTRY_SIZE);
+						pacer.spend(2 * COLD_ENTRY_SIZE);
+					}
+				}
+				if (ok)
+				{
+					int live = openLockedFeed(path, O_RDONLY, LOCK_EX);
+					if (drop < blocks)
+						ok = live >= 0 && rename(tmp_path.c_str(), cold_path.c_str()) == 0
+							&& rename(tmp_cdx_path.c_str(), cdx_path.c_str()) == 0;
+					else
+						ok = live >= 0 && unlink(cdx_path.c_str()) == 0 && unlink(cold_path.c_str()) == 0;
+					if (live >= 0)
+						close(live);
+				}
+				if (out >= 0)
+					close(out);
+				if (cdx_out >= 0)
+					close(cdx_out);
+				if (ok)
+				{
+					compaction_posts.add(dropped_posts);
+					compaction_reclaimed.add(cut + drop * COLD_ENTRY_SIZE);
+					LOG(LOG_INFO, "cold_blocks_dropped", "feed=%s blocks=%llu posts=%llu reclaimed_bytes=%lld", path.c_str(),
+						(unsigned long long) drop, (unsigned long long) dropped_posts, (long long) cut);
+				}
+				else
+				{
+					unlink(tmp_path.c_str());
+					unlink(tmp_cdx_path.c_str());
+				}
+			}
+			if (cdx >= 0)
+				close(cdx);
+			if (cold >= 0)
+				close(cold);
+			return cold_end;
+		}
+
+		// Offset of the record at a position of the index
+		bool readEntry(int idx, uint64_t position, off_t &offset)
+		{
+			char entry[INDEX_ENTRY_SIZE];
+			if (pread(idx, entry, INDEX_ENTRY_SIZE, INDEX_HEADER_SIZE + position * INDEX_ENTRY_SIZE) != INDEX_ENTRY_SIZE)
+				return false;
+			pacer.spend(INDEX_ENTRY_SIZE);
+			offset = decodeU64(entry);
+			return true;
+		}
+
+		// Append bytes [from, to) of in to out (paced, unless the feed is locked)
+		bool copyRange(int in, int out, off_t from, off_t to, bool paced)
+		{
+			std::vector<char> chunk(COMPACT_CHUNK);
+			while (from < to)
+			{
+				ssize_t n = pread(in, chunk.data(), std::min<off_t>(chunk.size(), to - from), from);
+				if (n <= 0 || !writeAll(out, chunk.data(), n))
+					return false;
+				from += n;
+				if (paced)
+					pacer.spend(2 * n);
+				else
+					compaction_io.add(2 * n);
+			}
+			return true;
+		}
+
+		// Append index entries [first, last) of in to out, moved back by cut bytes
+		bool copyEntries(int in, int out, uint64_t first, uint64_t last, off_t cut, bool paced)
+		{
+			std::vector<char> chunk(COMPACT_CHUNK);
+			while (first < last)
+			{
+				size_t count = std::min<uint64_t>(chunk.size() / INDEX_ENTRY_SIZE, last - first);
+				size_t bytes = count * INDEX_ENTRY_SIZE;
+				if (pread(in, chunk.data(), bytes, INDEX_HEADER_SIZE + first * INDEX_ENTRY_SIZE) != (ssize_t) bytes)
+					return false;
+				for (size_t i = 0; i < count; i++)
+					encodeU64(&chunk[i * INDEX_ENTRY_SIZE], decodeU64(&chunk[i * INDEX_ENTRY_SIZE]) - cut);
+				if (!writeAll(out, chunk.data(), bytes))
+					return false;
+				first += count;
+				if (paced)
+					pacer.spend(2 * bytes);
+				else
+					compaction_io.add(2 * bytes);
+			}
+			return true;
+		}
+
+		RetentionPolicy policy;
+		TierPolicy tier;
+		IoPacer pacer{0};
+		std::map<std::string, Counted> counted_feeds;
+
+		std::mutex mtx;
+		std::condition_variable cv;
+		bool stopping = false;
+		std::thread worker;
+};
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef FANOUT_H
+#define FANOUT_H
+
+#include <pthread.h>
+#include <sched.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "metrics.h"
+#include "presence.h"
+#include "sns.grpc.pb.h"
+
+/*
+ * Fan-out workers of the master (tsdm): the threads that write posts to the
+ * open timeline streams of the poster's followers.
+ *
+ * Without workers the thread handling the post writes to every follower's
+ * stream itself, and a follower slow to read holds up the poster (and the
+ * thread) until flow control lets the write through. With workers the post
+ * is acknowledged once it is on disk, and each follower's copy is queued on
+ * the worker owning that follower's stream (streams are spread over the
+ * workers, so each stream gets its posts in order). Workers can be pinned to
+ * CPUs, away from the RPC threads.
+ *
+ * A worker holding FANOUT_QUEUE_LIMIT posts drops further ones: they are in
+ * the follower's feed already and show up in its history.
+ */
+
+#define FANOUT_QUEUE_LIMIT 65536
+
+// Defined in server.cc
+extern Counter fanout_dropped;
+
+// Parse a CPU list such as "0,2-3", false if it is malformed
+inline bool parseCpuList(const std::string &list, std::vector<int> &cpus)
+{
+	std::stringstream in(list);
+	std::string item;
+	while (std::getline(in, item, ','))
+	{
+		size_t dash = item.find('-');
+		try
+		{
+			int first = std::stoi(item.substr(0, dash));
+			int last = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+			if (first < 0 || last < first || last >= CPU_SETSIZE)
+				return false;
+			for (int cpu = first; cpu <= last; cpu++)
+				cpus.push_back(cpu);
+		}
+		catch (const std::exception &)
+		{
+			return false;
+		}
+	}
+	return !cpus.empty();
+}
+
+class FanOutPool
+{
+	public:
+		~FanOutPool()
+		{
+			for (std::unique_ptr<Worker> &w : workers)
+			{
+				{
+					std::lock_guard<std::mutex> lock(w->mtx);
+					w->stopping = true;
+				}
+				w->cv.notify_one();
+				w->thread.join();
+			}
+		}
+
+		// Start the workers (none: posts are delivered by the thread handling them), pinned to the
+		// given CPUs in turn if any; false if a worker could not be pinned
+		bool start(int count, const std::vector<int> &cpus)
+		{
+			bool pinned = true;
+			for (int i = 0; i < count; i++)
+			{
+				workers.emplace_back(new Worker());
+				Worker *w = workers.back().get();
+				w->thread = std::thread(&FanOutPool::run, w);
+				if (!cpus.empty())
+				{
+					cpu_set_t set;
+					CPU_ZERO(&set);
+					CPU_SET(cpus[i % cpus.size()], &set);
+					pinned &= pthread_setaffinity_np(w->thread.native_handle(), sizeof(set), &set) == 0;
+				}
+			}
+			return pinned;
+		}
+
+		size_t size() const { return workers.size(); }
+
+		// Write a post to a follower's stream, on the worker owning the stream
+		void deliver(const std::shared_ptr<LiveStream> &stream, const csce438::Message &message)
+		{
+			if (workers.empty())
+			{
+				stream->write(message);
+				return;
+			}
+			Worker *w = workers[std::hash<LiveStream *>()(stream.get()) % workers.size()].get();
+			{
+				std::lock_guard<std::mutex> lock(w->mtx);
+				if (w->queue.size() >= FANOUT_QUEUE_LIMIT)
+				{
+					fanout_dropped.add();
+					return;
+				}
+				w->queue.push_back(std::make_pair(stream, message));
+			}
+			w->cv.notify_one();
+		}
+
+	private:
+		struct Worker
+		{
+			std::mutex mtx;
+			std::condition_variable cv;
+			std::deque<std::pair<std::shared_ptr<LiveStream>, csce438::Message>> queue;
+			bool stopping = false;
+			std::thread thread;
+		};
+
+		// Write out the queued posts a batch at a time, each stream's posts in one flush
+		static void run(Worker *w)
+		{
+			std::deque<std::pair<std::shared_ptr<LiveStream>, csce438::Message>> batch;
+			std::unordered_map<LiveStream *, size_t> index;
+			std::vector<std::pair<LiveStream *, std::vector<csce438::Message>>> per_stream;
+			std::unique_lock<std::mutex> lock(w->mtx);
+			while (true)
+			{
+				w->cv.wait(lock, [w]() { return w->stopping || !w->queue.empty(); });
+				if (w->queue.empty())
+					return;
+				batch.swap(w->queue);
+				lock.unlock();
+				// (the batch holds a reference to every stream until they are written)
+				for (std::pair<std::shared_ptr<LiveStream>, csce438::Message> &post : batch)
+				{
+					auto it = index.emplace(post.first.get(), per_stream.size());
+					if (it.second)
+						per_stream.emplace_back(post.first.get(), std::vector<csce438::Message>());
+					per_stream[it.first->second].second.push_back(std::move(post.second));
+				}
+				for (std::pair<LiveStream *, std::vector<csce438::Message>> &posts : per_stream)
+					posts.first->write(posts.second.data(), posts.second.size());
+				per_stream.clear();
+				index.clear();
+				batch.clear();
+				lock.lock();
+			}
+		}
+
+		std::vector<std::unique_ptr<Worker>> workers;
+};
+
+#endif
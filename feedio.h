@@ -0,0 +1,619 @@
+#ifndef FEEDIO_H
+#define FEEDIO_H
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#endif
+
+#include "storage.h"
+
+/*
+ * Storage I/O backends for the fan-out of a post.
+ *
+ * A post is appended to every follower's following feed (with an index
+ * entry) and to their own feed. The sync backend does that one file at a
+ * time through appendIndexedRecord() and appendRecord(). The io_uring backend
+ * keeps the feeds' descriptors open and queues all the writes of a
+ * fan-out, submitting up to URING_ENTRIES of them with a single
+ * io_uring_enter() (an index entry is linked behind its record). A
+ * completion thread reaps the ring and wakes each fan-out once all of its
+ * writes are done; a fan-out only holds the locks of its followers' feeds
+ * meanwhile, so posts to other feeds go ahead. A record left without its
+ * index entry is truncated away. The backend talks to the kernel through
+ * the raw system calls (no liburing), and the master falls back to the
+ * sync backend where io_uring cannot be set up (old kernels, seccomp
+ * filters).
+ */
+
+// Submission queue size of the io_uring backend (writes per io_uring_enter)
+#define URING_ENTRIES 1024
+
+// Most feeds whose descriptors the io_uring backend keeps open (3 descriptors each), within the
+// descriptor limit (raised to the hard limit) less FD_RESERVE for everything else
+#define FEED_FD_CACHE 8192
+#define FD_RESERVE 256
+
+class FeedBackend
+{
+	public:
+		virtual ~FeedBackend() {}
+
+		// Append a record to the given following feeds (indexed) and user feeds, one pair per follower
+		// Sets post_ids to the id each following feed gave the post (0 where the append failed)
+		virtual void appendFanOut(const std::string &record, const std::vector<std::string> &following_paths,
+								  const std::vector<std::string> &user_paths, std::vector<uint64_t> &post_ids) = 0;
+
+		// Forget any open descriptors (feeds were removed or rewritten behind the backend's back)
+		virtual void closeFeeds() {}
+
+		virtual const char *name() const = 0;
+};
+
+// The original path, one append at a time
+class SyncFeedBackend : public FeedBackend
+{
+	public:
+		void appendFanOut(const std::string &record, const std::vector<std::string> &following_paths,
+						  const std::vector<std::string> &user_paths, std::vector<uint64_t> &post_ids) override
+		{
+			post_ids.resize(following_paths.size());
+			for (size_t i = 0; i < following_paths.size(); i++)
+			{
+				post_ids[i] = appendIndexedRecord(following_paths[i], record);
+				appendRecord(user_paths[i], record);
+			}
+		}
+
+		const char *name() const override { return "sync"; }
+};
+
+#ifdef __linux__
+
+class UringFeedBackend : public FeedBackend
+{
+	public:
+		~UringFeedBackend()
+		{
+			stopReaper();
+			closeFeeds();
+			if (sqes != NULL)
+				munmap(sqes, sqes_size);
+			if (cq_ptr != NULL && cq_ptr != sq_ptr)
+				munmap(cq_ptr, cq_size);
+			if (sq_ptr != NULL)
+				munmap(sq_ptr, sq_size);
+			if (ring_fd >= 0)
+				close(ring_fd);
+		}
+
+		// Set up the ring and start the completion thread, false if io_uring is not available
+		bool init()
+		{
+			#ifdef __NR_io_uring_setup
+				struct io_uring_params params;
+				memset(&params, 0, sizeof(params));
+				ring_fd = syscall(__NR_io_uring_setup, URING_ENTRIES, &params);
+				if (ring_fd < 0)
+					return false;
+
+				sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+				cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+				bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+				if (single_mmap)
+					sq_size = cq_size = std::max(sq_size, cq_size);
+				sq_ptr = mapRing(sq_size, IORING_OFF_SQ_RING);
+				cq_ptr = single_mmap ? sq_ptr : mapRing(cq_size, IORING_OFF_CQ_RING);
+				sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+				sqes = (struct io_uring_sqe *) mapRing(sqes_size, IORING_OFF_SQES);
+				if (sq_ptr == NULL || cq_ptr == NULL || sqes == NULL)
+					return false;
+
+				char *sq = (char *) sq_ptr, *cq = (char *) cq_ptr;
+				sq_head = (std::atomic<unsigned> *) (sq + params.sq_off.head);
+				sq_tail = (std::atomic<unsigned> *) (sq + params.sq_off.tail);
+				sq_mask = *(unsigned *) (sq + params.sq_off.ring_mask);
+				sq_array = (unsigned *) (sq + params.sq_off.array);
+				sq_entries = params.sq_entries;
+				cq_head = (std::atomic<unsigned> *) (cq + params.cq_off.head);
+				cq_tail = (std::atomic<unsigned> *) (cq + params.cq_off.tail);
+				cq_mask = *(unsigned *) (cq + params.cq_off.ring_mask);
+				cq_entries = params.cq_entries;
+				cqes = (struct io_uring_cqe *) (cq + params.cq_off.cqes);
+
+				// Keep as many feeds open as the descriptor limit allows
+				struct rlimit limit;
+				if (getrlimit(RLIMIT_NOFILE, &limit) == 0)
+				{
+					if (limit.rlim_cur < limit.rlim_max)
+					{
+						limit.rlim_cur = limit.rlim_max;
+						setrlimit(RLIMIT_NOFILE, &limit);
+						getrlimit(RLIMIT_NOFILE, &limit);
+					}
+					if (limit.rlim_cur != RLIM_INFINITY)
+						cache_feeds = std::min<rlim_t>(cache_feeds, limit.rlim_cur > 2 * FD_RESERVE ? (limit.rlim_cur - FD_RESERVE) / 3 : 64);
+				}
+
+				reaper = std::thread(&UringFeedBackend::reap, this);
+				return true;
+			#else
+				return false;
+			#endif
+		}
+
+		void appendFanOut(const std::string &record, const std::vector<std::string> &following_paths,
+						  const std::vector<std::string> &user_paths, std::vector<uint64_t> &post_ids) override
+		{
+			size_t n = following_paths.size();
+			post_ids.assign(n, 0);
+
+			// Lock the following feeds in path order, so fan-outs overlapping us (ours or a hot restart's) cannot deadlock with us
+			std::vector<size_t> order(n);
+			for (size_t i = 0; i < n; i++)
+				order[i] = i;
+			std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return following_paths[a] < following_paths[b]; });
+
+			// At most cache_feeds followers at a time, to bound the descriptors a fan-out holds
+			for (size_t group = 0; group < n; group += cache_feeds)
+			{
+				std::vector<size_t> members(order.begin() + group, order.begin() + std::min<size_t>(n, group + cache_feeds));
+				appendGroup(record, following_paths, user_paths, members, post_ids);
+			}
+		}
+
+		// Fan-outs still holding a dropped feed's descriptors keep them until they are done
+		void closeFeeds() override
+		{
+			std::lock_guard<std::mutex> lock(feeds_mutex);
+			open_feeds.clear();
+		}
+
+		const char *name() const override { return "uring"; }
+
+	private:
+		// Descriptors of a follower's feeds
+		struct OpenFeed
+		{
+			int fd = -1;		// Following feed, written at the offsets recorded in its index
+			int idx_fd = -1;	// Its index, appended to
+			int user_fd = -1;	// The follower's own feed, appended to
+			uint64_t base_id = 0;
+			// Held by the fan-out writing the feeds (their flock() does not exclude threads sharing the descriptors)
+			std::mutex mtx;
+
+			~OpenFeed()
+			{
+				if (fd >= 0)
+					close(fd);
+				if (idx_fd >= 0)
+					close(idx_fd);
+				if (user_fd >= 0)
+					close(user_fd);
+			}
+		};
+
+		struct Batch;
+
+		// A queued write, and the fan-out it belongs to
+		struct Write
+		{
+			Batch *batch;
+			int fd;
+			const char *buf;
+			size_t len;
+			uint64_t offset;	// -1 appends (at the end of an O_APPEND file)
+			bool link;			// The next write waits for this one
+			int res;			// Its completion's result, set by the completion thread
+		};
+
+		// The writes of a group of followers, and how many have yet to complete
+		struct Batch
+		{
+			std::vector<Write> writes;
+			size_t remaining = 0;
+			std::mutex mtx;
+			std::condition_variable done;
+		};
+
+		// Append the record for the given followers (in locking order)
+		void appendGroup(const std::string &record, const std::vector<std::string> &following_paths,
+						 const std::vector<std::string> &user_paths, const std::vector<size_t> &members,
+						 std::vector<uint64_t> &post_ids)
+		{
+			// Open every feed before locking any: opening may index a feed under feedMutex(), which a
+			// compaction holds while it waits for a feed's lock. A feed a compaction replaced in the
+			// meantime is opened again, and the locks taken again.
+			std::vector<std::shared_ptr<OpenFeed>> feeds(members.size());
+			do
+			{
+				for (size_t m = 0; m < members.size(); m++)
+				{
+					if (!feeds[m])
+						feeds[m] = openFeed(following_paths[members[m]], user_paths[members[m]]);
+				}
+			} while (!lockFeeds(following_paths, user_paths, members, feeds));
+
+			Batch batch;
+			batch.writes.reserve(3 * members.size());
+			std::vector<off_t> feed_sizes(members.size(), -1), idx_sizes(members.size(), -1);
+			std::vector<char> entries(members.size() * INDEX_ENTRY_SIZE);
+			for (size_t m = 0; m < members.size(); m++)
+			{
+				OpenFeed *feed = feeds[m].get();
+				// The record goes at the end of the following feed and its index entry at the end of the index
+				struct stat feed_st, idx_st;
+				if (feed == NULL || fstat(feed->fd, &feed_st) < 0 || fstat(feed->idx_fd, &idx_st) < 0)
+					continue;
+				feed_sizes[m] = feed_st.st_size;
+				idx_sizes[m] = idx_st.st_size;
+				post_ids[members[m]] = feed->base_id + (idx_st.st_size - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE;
+				encodeU64(&entries[m * INDEX_ENTRY_SIZE], feed_st.st_size);
+				// (the index entry is linked to the record, so it is only written once the record is there)
+				queueWrite(batch, feed->fd, record.data(), record.size(), feed_st.st_size, true);
+				queueWrite(batch, feed->idx_fd, &entries[m * INDEX_ENTRY_SIZE], INDEX_ENTRY_SIZE, (uint64_t) -1, false);
+				queueWrite(batch, feed->user_fd, record.data(), record.size(), (uint64_t) -1, false);
+			}
+			submitAndWait(batch);
+
+			// Finish short writes synchronously (rare for regular files, but they cancel the linked index entry),
+			// and take back a record that did not get its index entry, which would shift every later post's offset
+			size_t w = 0;
+			for (size_t m = 0; m < members.size(); m++)
+			{
+				if (feed_sizes[m] < 0)
+					continue;
+				OpenFeed *feed = feeds[m].get();
+				bool indexed = finishWrite(batch.writes[w]) && finishWrite(batch.writes[w + 1]);
+				if (!indexed)
+				{
+					ftruncate(feed->fd, feed_sizes[m]);
+					ftruncate(feed->idx_fd, idx_sizes[m]);
+				}
+				if (!finishWrite(batch.writes[w + 2]) || !indexed)
+					post_ids[members[m]] = 0;
+				w += 3;
+			}
+
+			unlockFeeds(feeds);
+		}
+
+		// Take the feeds' locks: their mutexes in following path order, then their flock()s in path order
+		// Returns false, with nothing locked, if a feed was replaced since it was opened (it is forgotten)
+		bool lockFeeds(const std::vector<std::string> &following_paths, const std::vector<std::string> &user_paths,
+					   const std::vector<size_t> &members, std::vector<std::shared_ptr<OpenFeed>> &feeds)
+		{
+			for (const std::shared_ptr<OpenFeed> &feed : feeds)
+			{
+				if (feed)
+					feed->mtx.lock();
+			}
+
+			std::vector<std::pair<const std::string *, int>> files;
+			for (size_t m = 0; m < members.size(); m++)
+			{
+				if (!feeds[m])
+					continue;
+				files.push_back(std::make_pair(&following_paths[members[m]], feeds[m]->fd));
+				files.push_back(std::make_pair(&user_paths[members[m]], feeds[m]->user_fd));
+			}
+			std::sort(files.begin(), files.end(), [](const std::pair<const std::string *, int> &a, const std::pair<const std::string *, int> &b)
+			{
+				return *a.first < *b.first;
+			});
+			for (size_t f = 0; f < files.size(); f++)
+			{
+				// (a path locked through another descriptor already would wait on ourselves)
+				if (f == 0 || *files[f].first != *files[f - 1].first)
+					flock(files[f].second, LOCK_EX);
+			}
+
+			std::vector<size_t> replaced;
+			for (size_t m = 0; m < members.size(); m++)
+			{
+				size_t i = members[m];
+				if (feeds[m] && !(isFile(feeds[m]->fd, following_paths[i]) && isFile(feeds[m]->idx_fd, feedIndexPath(following_paths[i]))
+								  && isFile(feeds[m]->user_fd, user_paths[i])))
+					replaced.push_back(m);
+			}
+			if (replaced.empty())
+				return true;
+
+			unlockFeeds(feeds);
+			for (size_t m : replaced)
+			{
+				forgetFeed(following_paths[members[m]], feeds[m]);
+				feeds[m].reset();
+			}
+			return false;
+		}
+
+		void unlockFeeds(const std::vector<std::shared_ptr<OpenFeed>> &feeds)
+		{
+			for (size_t m = 0; m < feeds.size(); m++)
+			{
+				if (!feeds[m])
+					continue;
+				flock(feeds[m]->fd, LOCK_UN);
+				flock(feeds[m]->user_fd, LOCK_UN);
+				feeds[m]->mtx.unlock();
+			}
+		}
+
+		// Whether the descriptor is still the file at the path (a compaction renames a new file over it)
+		static bool isFile(int fd, const std::string &path)
+		{
+			struct stat fd_st, path_st;
+			return fstat(fd, &fd_st) == 0 && stat(path.c_str(), &path_st) == 0
+				&& fd_st.st_dev == path_st.st_dev && fd_st.st_ino == path_st.st_ino;
+		}
+
+		void *mapRing(size_t size, off_t offset)
+		{
+			void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+			return ptr == MAP_FAILED ? NULL : ptr;
+		}
+
+		// Open (or reuse) the descriptors of a follower's feeds, creating them and the index if needed
+		std::shared_ptr<OpenFeed> openFeed(const std::string &following_path, const std::string &user_path)
+		{
+			{
+				std::lock_guard<std::mutex> lock(feeds_mutex);
+				auto it = open_feeds.find(following_path);
+				if (it != open_feeds.end())
+					return it->second;
+			}
+
+			// ensureIndex() needs the feed to exist to index it (an empty one gets an empty index)
+			std::shared_ptr<OpenFeed> feed(new OpenFeed());
+			feed->fd = open(following_path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+			if (feed->fd < 0)
+				return NULL;
+			{
+				std::lock_guard<std::mutex> lock(feedMutex());
+				if (!ensureIndex(following_path))
+					return NULL;
+			}
+			char header[INDEX_HEADER_SIZE];
+			feed->idx_fd = open(feedIndexPath(following_path).c_str(), O_RDWR | O_APPEND | O_CLOEXEC);
+			if (feed->idx_fd < 0 || pread(feed->idx_fd, header, INDEX_HEADER_SIZE, 0) != INDEX_HEADER_SIZE
+					|| (feed->user_fd = open(user_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644)) < 0)
+				return NULL;
+			feed->base_id = decodeU64(header);
+
+			// (another fan-out may have opened the feed meanwhile, the first one opened is kept)
+			std::lock_guard<std::mutex> lock(feeds_mutex);
+			if (open_feeds.size() >= cache_feeds && open_feeds.count(following_path) == 0)
+				open_feeds.clear();
+			return open_feeds.insert(std::make_pair(following_path, feed)).first->second;
+		}
+
+		void forgetFeed(const std::string &following_path, const std::shared_ptr<OpenFeed> &feed)
+		{
+			std::lock_guard<std::mutex> lock(feeds_mutex);
+			auto it = open_feeds.find(following_path);
+			if (it != open_feeds.end() && it->second == feed)
+				open_feeds.erase(it);
+		}
+
+		static void queueWrite(Batch &batch, int fd, const char *buf, size_t len, uint64_t offset, bool link)
+		{
+			Write w;
+			w.batch = &batch;
+			w.fd = fd;
+			w.buf = buf;
+			w.len = len;
+			w.offset = offset;
+			w.link = link;
+			w.res = -EIO;
+			batch.writes.push_back(w);
+		}
+
+		// Submit the batch's writes, sq_entries at a time (whole followers, so no link is split), and wait
+		// for the completion thread to have seen them all
+		void submitAndWait(Batch &batch)
+		{
+			batch.remaining = batch.writes.size();
+			size_t chunk = sq_entries - sq_entries % 3;
+			for (size_t start = 0; start < batch.writes.size(); start += chunk)
+			{
+				size_t count = std::min<size_t>(chunk, batch.writes.size() - start);
+				std::unique_lock<std::mutex> lock(submit_mutex);
+				// Never have more writes in flight than the completion queue holds
+				room.wait(lock, [&]() { return inflight + count <= cq_entries; });
+
+				unsigned tail = sq_tail->load(std::memory_order_relaxed);
+				for (size_t i = start; i < start + count; i++)
+				{
+					const Write &w = batch.writes[i];
+					unsigned index = tail & sq_mask;
+					struct io_uring_sqe *sqe = &sqes[index];
+					memset(sqe, 0, sizeof(*sqe));
+					sqe->opcode = IORING_OP_WRITE;
+					sqe->fd = w.fd;
+					sqe->addr = (uint64_t) (uintptr_t) w.buf;
+					sqe->len = w.len;
+					sqe->off = w.offset;
+					sqe->flags = w.link ? IOSQE_IO_LINK : 0;
+					sqe->user_data = (uint64_t) (uintptr_t) &batch.writes[i];
+					sq_array[index] = index;
+					tail++;
+				}
+				sq_tail->store(tail, std::memory_order_release);
+
+				size_t submitted = 0;
+				while (submitted < count)
+				{
+					int ret = syscall(__NR_io_uring_enter, ring_fd, count - submitted, 0, 0, NULL, 0);
+					if (ret > 0)
+						submitted += ret;
+					else if (ret < 0 && errno != EINTR && errno != EAGAIN)
+						break;
+				}
+				inflight += submitted;
+
+				// Take back what the kernel refused, those writes fail
+				if (submitted < count)
+				{
+					sq_tail->store(sq_head->load(std::memory_order_acquire), std::memory_order_release);
+					std::lock_guard<std::mutex> batch_lock(batch.mtx);
+					batch.remaining -= count - submitted;
+				}
+			}
+
+			std::unique_lock<std::mutex> lock(batch.mtx);
+			batch.done.wait(lock, [&]() { return batch.remaining == 0; });
+		}
+
+		// Completion thread: hands each completed write's result to its batch, and wakes the batch's
+		// fan-out once its last write is done (a completion without a write stops the thread)
+		void reap()
+		{
+			while (true)
+			{
+				if (syscall(__NR_io_uring_enter, ring_fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR)
+					return;
+				bool stop = false;
+				size_t reaped = 0;
+				unsigned head = cq_head->load(std::memory_order_relaxed);
+				while (head != cq_tail->load(std::memory_order_acquire))
+				{
+					struct io_uring_cqe *cqe = &cqes[head & cq_mask];
+					if (cqe->user_data == 0)
+						stop = true;
+					else
+					{
+						Write *w = (Write *) (uintptr_t) cqe->user_data;
+						std::lock_guard<std::mutex> lock(w->batch->mtx);
+						w->res = cqe->res;
+						if (--w->batch->remaining == 0)
+							w->batch->done.notify_all();
+					}
+					head++;
+					reaped++;
+				}
+				cq_head->store(head, std::memory_order_release);
+
+				if (reaped > 0)
+				{
+					std::lock_guard<std::mutex> lock(submit_mutex);
+					inflight -= reaped;
+					room.notify_all();
+				}
+				if (stop)
+					return;
+			}
+		}
+
+		void stopReaper()
+		{
+			if (!reaper.joinable())
+				return;
+			{
+				std::unique_lock<std::mutex> lock(submit_mutex);
+				room.wait(lock, [&]() { return inflight < cq_entries; });
+				unsigned tail = sq_tail->load(std::memory_order_relaxed);
+				unsigned index = tail & sq_mask;
+				memset(&sqes[index], 0, sizeof(sqes[index]));
+				sqes[index].opcode = IORING_OP_NOP;
+				sq_array[index] = index;
+				sq_tail->store(tail + 1, std::memory_order_release);
+				inflight++;
+				syscall(__NR_io_uring_enter, ring_fd, 1, 0, 0, NULL, 0);
+			}
+			reaper.join();
+		}
+
+		// Complete a write the kernel did not finish (a short write, or an index entry cancelled behind one)
+		static bool finishWrite(const Write &w)
+		{
+			if (w.res < 0 && w.res != -ECANCELED)
+				return false;
+			size_t done = w.res < 0 ? 0 : w.res;
+			if (done >= w.len)
+				return true;
+			if (w.offset == (uint64_t) -1)
+				return writeAll(w.fd, w.buf + done, w.len - done);
+			while (done < w.len)
+			{
+				ssize_t n = pwrite(w.fd, w.buf + done, w.len - done, w.offset + done);
+				if (n <= 0)
+					return false;
+				done += n;
+			}
+			return true;
+		}
+
+		int ring_fd = -1;
+		void *sq_ptr = NULL, *cq_ptr = NULL;
+		size_t sq_size = 0, cq_size = 0, sqes_size = 0;
+		struct io_uring_sqe *sqes = NULL;
+		std::atomic<unsigned> *sq_head = NULL, *sq_tail = NULL, *cq_head = NULL, *cq_tail = NULL;
+		unsigned *sq_array = NULL;
+		unsigned sq_mask = 0, cq_mask = 0, sq_entries = 0, cq_entries = 0;
+		struct io_uring_cqe *cqes = NULL;
+
+		// Submission queue, and the writes submitted whose completions are not reaped yet
+		std::mutex submit_mutex;
+		std::condition_variable room;
+		size_t inflight = 0;
+		std::thread reaper;
+
+		std::mutex feeds_mutex;
+		std::map<std::string, std::shared_ptr<OpenFeed>> open_feeds;
+		size_t cache_feeds = FEED_FD_CACHE;
+};
+
+#endif
+
+// The backend fan-out writes go through
+inline std::unique_ptr<FeedBackend> &feedBackend()
+{
+	static std::unique_ptr<FeedBackend> backend(new SyncFeedBackend());
+	return backend;
+}
+
+// Switch to the named backend ("sync" or "uring"), falling back to sync if io_uring cannot be set up
+// Returns false for an unknown name
+inline bool selectFeedBackend(const std::string &name)
+{
+	if (name == "sync")
+	{
+		feedBackend().reset(new SyncFeedBackend());
+		return true;
+	}
+	if (name != "uring")
+		return false;
+	#ifdef __linux__
+		std::unique_ptr<UringFeedBackend> uring(new UringFeedBackend());
+		if (uring->init())
+		{
+			feedBackend().reset(uring.release());
+			return true;
+		}
+	#endif
+	feedBackend().reset(new SyncFeedBackend());
+	return true;
+}
+
+#endif
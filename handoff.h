@@ -0,0 +1,114 @@
+#ifndef HANDOFF_H
+#define HANDOFF_H
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/*
+ * Hot restart of a master (tsdm): the running process hands over to a new
+ * one without dropping clients.
+ *
+ * Every master listens on a Unix socket in the abstract namespace named
+ * after its client port. A new process started with -H connects to it and
+ * the two exchange:
+ *
+ *     new -> old   "HANDOFF"
+ *     old -> new   its heartbeat sockets (the listener and the connection
+ *                  to its slave) as SCM_RIGHTS, then a length prefixed
+ *                  Snapshot of the registry and follower graph
+ *     new -> old   "READY" once it serves clients on the same port
+ *
+ * The client port itself is shared through SO_REUSEPORT (gRPC cannot adopt
+ * a listening descriptor). After READY the old process stops accepting
+ * connections and drains: it asks its open timeline streams, a few at a
+ * time, to reopen, which clients do on the same address without asking the
+ * router, and exits once they are gone or the drain time is up.
+ */
+
+// Default time the old process of a hot restart drains its streams for
+#define DRAIN_MS 2000
+
+// Abstract Unix socket address of the master serving clients on a port
+inline socklen_t handoffAddress(const std::string &client_port, struct sockaddr_un &addr)
+{
+	std::string name = "tsdm-handoff-" + client_port;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	// Leading NUL: abstract namespace, nothing to clean up on disk
+	memcpy(addr.sun_path + 1, name.c_str(), name.size());
+	return offsetof(struct sockaddr_un, sun_path) + 1 + name.size();
+}
+
+// Send a message along with descriptors
+inline bool sendWithFds(int sock, const std::string &msg, const std::vector<int> &fds)
+{
+	struct iovec iov;
+	iov.iov_base = (void *) msg.data();
+	iov.iov_len = msg.size();
+	std::vector<char> control(CMSG_SPACE(sizeof(int) * fds.size()));
+	struct msghdr hdr;
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.msg_iov = &iov;
+	hdr.msg_iovlen = 1;
+	hdr.msg_control = control.data();
+	hdr.msg_controllen = control.size();
+	struct cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+	memcpy(CMSG_DATA(cmsg), fds.data(), sizeof(int) * fds.size());
+	return sendmsg(sock, &hdr, MSG_NOSIGNAL) == (ssize_t) msg.size();
+}
+
+// Receive a message of up to len bytes along with the descriptors sent with it
+// Returns the number of bytes received (0 or less on failure)
+inline ssize_t recvWithFds(int sock, char *buf, size_t len, std::vector<int> &fds)
+{
+	struct iovec iov;
+	iov.iov_base = buf;
+	iov.iov_len = len;
+	char control[CMSG_SPACE(sizeof(int) * 8)];
+	struct msghdr hdr;
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.msg_iov = &iov;
+	hdr.msg_iovlen = 1;
+	hdr.msg_control = control;
+	hdr.msg_controllen = sizeof(control);
+	ssize_t n = recvmsg(sock, &hdr, MSG_CMSG_CLOEXEC);
+	for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr); n > 0 && cmsg != NULL; cmsg = CMSG_NXTHDR(&hdr, cmsg))
+	{
+		if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+			continue;
+		size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+		const int *received = (const int *) CMSG_DATA(cmsg);
+		fds.assign(received, received + count);
+	}
+	return n;
+}
+
+// Send a length prefixed frame
+inline bool sendFrame(int sock, const std::string &payload)
+{
+	uint32_t len = payload.size();
+	std::string frame((const char *) &len, sizeof(len));
+	frame += payload;
+	return send(sock, frame.data(), frame.size(), MSG_NOSIGNAL) == (ssize_t) frame.size();
+}
+
+// Receive a length prefixed frame
+inline bool recvFrame(int sock, std::string &payload)
+{
+	uint32_t len;
+	if (recv(sock, &len, sizeof(len), MSG_WAITALL) != sizeof(len))
+		return false;
+	payload.resize(len);
+	return len == 0 || recv(sock, &payload[0], len, MSG_WAITALL) == (ssize_t) len;
+}
+
+#endif
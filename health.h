@@ -0,0 +1,181 @@
+#ifndef HEALTH_H
+#define HEALTH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <grpc++/grpc++.h>
+#include <grpc++/generic/generic_stub.h>
+
+#include "metrics.h"
+#include "ratelimit.h"
+#include "timerwheel.h"
+
+/*
+ * Active health checking of masters by the router.
+ *
+ * Every watched master is sent a standard grpc.health.v1.Health/Check call
+ * once per probe interval, with the interval as its deadline. Calls are
+ * asynchronous on a completion queue and scheduled on a timer wheel, so the
+ * router's select() loop drives them without a thread of its own and never
+ * blocks on a dead host. A master is reported down after a number of
+ * consecutive failed probes and up again after RESTORE_PROBES good ones.
+ */
+
+// Consecutive successful probes before an evicted master is restored
+#define RESTORE_PROBES 2
+
+// Granularity of probe scheduling
+#define HEALTH_TICK_MS 5
+
+extern LatencyMetric health_probe_rtt;
+extern Counter health_probe_failures;
+
+class HealthChecker
+{
+	public:
+		HealthChecker(int64_t interval_ns, int failure_threshold)
+			: interval_ns(interval_ns), failure_threshold(failure_threshold),
+			  wheel(HEALTH_TICK_MS * 1000000LL, 256, monotonicNanos()) {}
+
+		~HealthChecker()
+		{
+			cq.Shutdown();
+			void *tag;
+			bool ok;
+			while (cq.Next(&tag, &ok))
+				delete static_cast<Probe *>(tag);
+		}
+
+		// Start probing the master serving clients at target ("ip:port"), assumed up to begin with
+		void watch(uint64_t id, const std::string &target)
+		{
+			Target &t = targets[id];
+			t.stub.reset(new grpc::GenericStub(grpc::CreateChannel(target, grpc::InsecureChannelCredentials())));
+			wheel.schedule(id, monotonicNanos() + interval_ns);
+		}
+
+		// Stop probing a master (an outstanding probe is ignored when it completes)
+		void unwatch(uint64_t id)
+		{
+			targets.erase(id);
+		}
+
+		// Collect completed probes and send the ones that are due, without blocking
+		// Appends (id, up) for every master whose health changed
+		void poll(std::vector<std::pair<uint64_t, bool>> &changes)
+		{
+			void *tag;
+			bool ok;
+			while (cq.AsyncNext(&tag, &ok, std::chrono::system_clock::now()) == grpc::CompletionQueue::GOT_EVENT)
+			{
+				Probe *probe = static_cast<Probe *>(tag);
+				complete(probe, ok, changes);
+				delete probe;
+			}
+
+			std::vector<uint64_t> due;
+			wheel.advance(monotonicNanos(), due);
+			for (uint64_t id : due)
+				send(id);
+		}
+
+		// Time until poll() next has probes to send, for the event loop's timeout
+		int64_t untilNextPoll() const
+		{
+			return wheel.untilNextTick(monotonicNanos());
+		}
+
+	private:
+		struct Target
+		{
+			std::unique_ptr<grpc::GenericStub> stub;
+			bool up = true;
+			int failures = 0;
+			int successes = 0;
+		};
+
+		struct Probe
+		{
+			uint64_t id;
+			int64_t sent_ns;
+			grpc::ClientContext context;
+			grpc::ByteBuffer response;
+			grpc::Status status;
+			std::unique_ptr<grpc::ClientAsyncResponseReader<grpc::ByteBuffer>> call;
+		};
+
+		void send(uint64_t id)
+		{
+			auto it = targets.find(id);
+			if (it == targets.end())
+				return;
+			Probe *probe = new Probe();
+			probe->id = id;
+			probe->sent_ns = monotonicNanos();
+			probe->context.set_deadline(std::chrono::system_clock::now() + std::chrono::nanoseconds(interval_ns));
+
+			// An empty HealthCheckRequest asks about the server as a whole
+			// (sent as one empty slice, a ByteBuffer without any slices is not a valid message)
+			grpc::Slice empty(std::string(""));
+			grpc::ByteBuffer request(&empty, 1);
+			probe->call = it->second.stub->PrepareUnaryCall(&probe->context, "/grpc.health.v1.Health/Check", request, &cq);
+			probe->call->StartCall();
+			probe->call->Finish(&probe->response, &probe->status, probe);
+		}
+
+		// A HealthCheckResponse of SERVING is field 1 (status) set to 1
+		static bool isServing(const grpc::ByteBuffer &response)
+		{
+			grpc::Slice slice;
+			if (!response.DumpToSingleSlice(&slice).ok())
+				return false;
+			std::string body((const char *) slice.begin(), slice.size());
+			return body == std::string("\x08\x01", 2);
+		}
+
+		void complete(Probe *probe, bool ok, std::vector<std::pair<uint64_t, bool>> &changes)
+		{
+			auto it = targets.find(probe->id);
+			if (it == targets.end())
+				return;
+			Target &t = it->second;
+			int64_t now = monotonicNanos();
+			if (ok && probe->status.ok() && isServing(probe->response))
+			{
+				health_probe_rtt.record(now - probe->sent_ns);
+				t.failures = 0;
+				if (!t.up && ++t.successes >= RESTORE_PROBES)
+				{
+					t.up = true;
+					changes.push_back(std::make_pair(probe->id, true));
+				}
+			}
+			else
+			{
+				health_probe_failures.add();
+				t.successes = 0;
+				if (t.up && ++t.failures >= failure_threshold)
+				{
+					t.up = false;
+					changes.push_back(std::make_pair(probe->id, false));
+				}
+			}
+
+			// One probe per interval, measured from when this one was sent
+			wheel.schedule(probe->id, std::max(now, probe->sent_ns + interval_ns));
+		}
+
+		const int64_t interval_ns;
+		const int failure_threshold;
+		grpc::CompletionQueue cq;
+		TimerWheel wheel;
+		std::map<uint64_t, Target> targets;
+};
+
+#endif
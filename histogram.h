@@ -0,0 +1,126 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*
+ * Log-linear latency histogram.
+ *
+ * Values are bucketed by their highest set bit plus the next SUB_BITS bits,
+ * so every bucket is within ~6% of the values it holds and recording is a
+ * couple of shifts and an increment. Not thread safe; give each thread its
+ * own histogram and merge() them when reporting.
+ */
+class LatencyHistogram
+{
+    public:
+        static const int SUB_BITS = 4;
+        static const int SUB_BUCKETS = 1 << SUB_BITS;
+        static const int NUM_BUCKETS = 64 * SUB_BUCKETS;
+
+        LatencyHistogram() : buckets(NUM_BUCKETS, 0) {}
+
+        void record(uint64_t value)
+        {
+            buckets[bucketOf(value)]++;
+            total++;
+            sum += value;
+            if (value > max_value) max_value = value;
+            if (total == 1 || value < min_value) min_value = value;
+        }
+
+        void merge(const LatencyHistogram &other)
+        {
+            for (int i = 0; i < NUM_BUCKETS; i++)
+                buckets[i] += other.buckets[i];
+            if (other.total != 0 && (total == 0 || other.min_value < min_value))
+                min_value = other.min_value;
+            if (other.max_value > max_value)
+                max_value = other.max_value;
+            total += other.total;
+            sum += other.sum;
+        }
+
+        void reset()
+        {
+            buckets.assign(NUM_BUCKETS, 0);
+            total = sum = max_value = min_value = 0;
+        }
+
+        uint64_t count() const { return total; }
+        uint64_t min() const { return min_value; }
+        uint64_t max() const { return max_value; }
+        double mean() const { return total ? (double) sum / total : 0; }
+
+        // Smallest recorded value v such that a fraction p (0..1) of all values are <= v
+        // (reported as the upper edge of its bucket, clamped to the observed maximum)
+        uint64_t percentile(double p) const
+        {
+            if (total == 0)
+                return 0;
+            uint64_t rank = (uint64_t) (p * total + 0.5);
+            if (rank < 1) rank = 1;
+            if (rank > total) rank = total;
+
+            uint64_t seen = 0;
+            for (int i = 0; i < NUM_BUCKETS; i++)
+            {
+                seen += buckets[i];
+                if (seen >= rank)
+                {
+                    uint64_t upper = upperBound(i);
+                    return upper < max_value ? upper : max_value;
+                }
+            }
+            return max_value;
+        }
+
+        // Bucket index for a value, exposed for callers that keep their own (e.g. atomic) counts
+        static int bucketOf(uint64_t value)
+        {
+            if (value < SUB_BUCKETS)
+                return (int) value;
+            int msb = 63 - __builtin_clzll(value);
+            int shift = msb - SUB_BITS;
+            return (shift + 1) * SUB_BUCKETS + (int) ((value >> shift) & (SUB_BUCKETS - 1));
+        }
+
+        // Largest value that falls in the given bucket
+        static uint64_t upperBound(int bucket)
+        {
+            if (bucket < SUB_BUCKETS)
+                return bucket;
+            int shift = bucket / SUB_BUCKETS - 1;
+            uint64_t sub = bucket % SUB_BUCKETS;
+            if (shift + SUB_BITS >= 63)
+                return UINT64_MAX;
+            return (((uint64_t) SUB_BUCKETS | sub) << shift) + ((1ULL << shift) - 1);
+        }
+
+    private:
+        std::vector<uint64_t> buckets;
+        uint64_t total = 0;
+        uint64_t sum = 0;
+        uint64_t min_value = 0;
+        uint64_t max_value = 0;
+};
+
+// Format a nanosecond duration with a sensible unit, e.g. "1.25ms"
+inline std::string formatNanos(uint64_t ns)
+{
+    char buf[32];
+    if (ns < 1000)
+        snprintf(buf, sizeof(buf), "%luns", (unsigned long) ns);
+    else if (ns < 1000000)
+        snprintf(buf, sizeof(buf), "%.2fus", ns / 1e3);
+    else if (ns < 1000000000)
+        snprintf(buf, sizeof(buf), "%.2fms", ns / 1e6);
+    else
+        snprintf(buf, sizeof(buf), "%.2fs", ns / 1e9);
+    return std::string(buf);
+}
+
+#endif
@@ -0,0 +1,380 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <signal.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "metrics.h"
+
+/*
+ * Server logging, cheap enough to leave on in production.
+ *
+ * A thread formats its line straight into a ring of fixed size records of
+ * its own; the flusher thread is the ring's only reader, so logging takes no
+ * lock and makes no system call. Every LOG_FLUSH_MS the flusher empties all
+ * the rings, orders the lines by time and writes them to stderr at once. A
+ * thread whose ring is full drops the line (tsns_log_dropped_total), and a
+ * line below the current level costs one relaxed load.
+ *
+ * Lines are logfmt, an event name followed by the caller's key=value pairs:
+ *
+ *     ts=2026-10-18T09:30:00.123456Z level=warn thread=4242 event=stream_shed user=alice
+ *
+ * The level is given with '-l' (debug, info, warn, error or off; debug in
+ * DEBUG builds, info otherwise) and raised or lowered at runtime with SIGUSR1
+ * (more verbose) and SIGUSR2 (less verbose). Lines on paths run per request
+ * or per message use LOG_EVERY_MS, which logs at most one line per interval
+ * from that call site and counts the ones it held back.
+ */
+
+#define LOG_RING_RECORDS 256
+#define LOG_RECORD_SIZE 256
+#define LOG_FLUSH_MS 20
+
+enum LogLevel
+{
+	LOG_DEBUG = 0,
+	LOG_INFO,
+	LOG_WARN,
+	LOG_ERROR,
+	LOG_OFF
+};
+
+extern Counter log_dropped;
+
+inline const char *logLevelName(int level)
+{
+	static const char *names[] = {"debug", "info", "warn", "error", "off"};
+	return names[std::max(0, std::min(level, (int) LOG_OFF))];
+}
+
+// Parse a level name, false if it is not one
+inline bool parseLogLevel(const std::string &name, LogLevel &level)
+{
+	for (int l = LOG_DEBUG; l <= LOG_OFF; l++)
+		if (name == logLevelName(l))
+		{
+			level = (LogLevel) l;
+			return true;
+		}
+	return false;
+}
+
+class Logger;
+inline Logger &logger();
+
+class Logger
+{
+	public:
+		#ifdef DEBUG
+			std::atomic<int> level{LOG_DEBUG};
+		#else
+			std::atomic<int> level{LOG_INFO};
+		#endif
+
+		bool enabled(LogLevel l) const { return l >= level.load(std::memory_order_relaxed); }
+
+		// Append a line to the calling thread's ring: the event, the pairs (format starts with the
+		// space between them) and how many lines LOG_EVERY_MS held back before it
+		void write(LogLevel l, const char *event, uint64_t suppressed, const char *format, va_list args)
+		{
+			Ring *ring = threadRing();
+			uint64_t head = ring->head.load(std::memory_order_relaxed);
+			if (head - ring->tail.load(std::memory_order_acquire) >= LOG_RING_RECORDS)
+			{
+				log_dropped.add();
+				return;
+			}
+			Record &r = ring->records[head % LOG_RING_RECORDS];
+			struct timespec now;
+			clock_gettime(CLOCK_REALTIME, &now);
+			r.wall_ns = now.tv_sec * 1000000000LL + now.tv_nsec;
+			r.level = l;
+			// (each part is cut to what fits, len never counts past the text)
+			const int size = sizeof(r.text);
+			int len = std::min(std::max(snprintf(r.text, size, "event=%s", event), 0), size - 1);
+			if (format[1] != '\0')
+				len = std::min(len + std::max(vsnprintf(r.text + len, size - len, format, args), 0), size - 1);
+			if (suppressed > 0 && len < size - 1)
+				len = std::min(len + std::max(snprintf(r.text + len, size - len, " suppressed=%llu",
+					(unsigned long long) suppressed), 0), size - 1);
+			r.len = len;
+			ring->head.store(head + 1, std::memory_order_release);
+		}
+
+		// Write out every line logged so far
+		void flush()
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			if (!flusher.joinable())
+				return;
+			uint64_t wanted = passes + 2;	// (a pass under way may have missed the newest lines)
+			cv.notify_one();
+			done.wait(lock, [this, wanted]() { return passes >= wanted || stopping; });
+		}
+
+		// Stop the flusher after a last pass (at exit)
+		void stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mtx);
+				if (!flusher.joinable() || stopping)
+					return;
+				stopping = true;
+			}
+			cv.notify_one();
+			flusher.join();
+		}
+
+	private:
+		struct Record
+		{
+			int64_t wall_ns;
+			int32_t level;
+			int32_t len;
+			char text[LOG_RECORD_SIZE - 16];
+		};
+
+		// Written by its thread only, read by the flusher only
+		struct Ring
+		{
+			Record records[LOG_RING_RECORDS];
+			std::atomic<uint64_t> head{0};
+			std::atomic<uint64_t> tail{0};
+			std::atomic<bool> retired{false};	// Its thread exited, freed once emptied
+			long thread_id = 0;
+		};
+
+		struct Line
+		{
+			Record record;
+			long thread_id;
+		};
+
+		struct RingOwner
+		{
+			Ring *ring = NULL;
+			~RingOwner()
+			{
+				if (ring != NULL)
+					ring->retired.store(true, std::memory_order_release);
+			}
+		};
+
+		// The calling thread's ring, registered (and the flusher started) on its first line
+		Ring *threadRing()
+		{
+			static thread_local RingOwner owner;
+			if (owner.ring == NULL)
+			{
+				owner.ring = new Ring();
+				owner.ring->thread_id = syscall(SYS_gettid);
+				std::lock_guard<std::mutex> lock(mtx);
+				rings.push_back(owner.ring);
+				if (!flusher.joinable() && !stopping)
+				{
+					flusher = std::thread(&Logger::run, this);
+					atexit([]() { logger().stop(); });
+				}
+			}
+			return owner.ring;
+		}
+
+		void run()
+		{
+			int shown_level = level.load();
+			std::vector<Line> lines;
+			std::string out;
+			std::unique_lock<std::mutex> lock(mtx);
+			while (true)
+			{
+				bool last = stopping;
+				// Empty the rings (a retired ring seen before emptying it holds no more lines after)
+				for (size_t i = 0; i < rings.size(); )
+				{
+					Ring *ring = rings[i];
+					bool retired = ring->retired.load(std::memory_order_acquire);
+					uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+					uint64_t head = ring->head.load(std::memory_order_acquire);
+					for (; tail < head; tail++)
+						lines.push_back(Line{ring->records[tail % LOG_RING_RECORDS], ring->thread_id});
+					ring->tail.store(tail, std::memory_order_release);
+					if (retired)
+					{
+						delete ring;
+						rings[i] = rings.back();
+						rings.pop_back();
+					}
+					else
+						i++;
+				}
+				lock.unlock();
+
+				int current = level.load();
+				if (current != shown_level)
+				{
+					format(out, LOG_INFO, "event=log_level level_now=" + std::string(logLevelName(current)), 0, 0);
+					shown_level = current;
+				}
+				std::stable_sort(lines.begin(), lines.end(),
+					[](const Line &a, const Line &b) { return a.record.wall_ns < b.record.wall_ns; });
+				for (const Line &line : lines)
+					format(out, line.record.level, std::string(line.record.text, line.record.len), line.record.wall_ns, line.thread_id);
+				writeOut(out);
+				out.clear();
+				lines.clear();
+
+				lock.lock();
+				passes++;
+				done.notify_all();
+				if (last)
+					return;
+				cv.wait_for(lock, std::chrono::milliseconds(LOG_FLUSH_MS));
+			}
+		}
+
+		// One line: time (now if 0), level, thread, then the record
+		static void format(std::string &out, int l, const std::string &text, int64_t wall_ns, long thread_id)
+		{
+			if (wall_ns == 0)
+			{
+				struct timespec now;
+				clock_gettime(CLOCK_REALTIME, &now);
+				wall_ns = now.tv_sec * 1000000000LL + now.tv_nsec;
+			}
+			time_t seconds = wall_ns / 1000000000LL;
+			struct tm utc;
+			gmtime_r(&seconds, &utc);
+			char prefix[96];
+			size_t len = strftime(prefix, sizeof(prefix), "ts=%Y-%m-%dT%H:%M:%S", &utc);
+			snprintf(prefix + len, sizeof(prefix) - len, ".%06lldZ level=%s thread=%ld ",
+				(long long) (wall_ns % 1000000000LL) / 1000, logLevelName(l), thread_id);
+			out += prefix;
+			out += text;
+			out += '\n';
+		}
+
+		static void writeOut(const std::string &out)
+		{
+			size_t written = 0;
+			while (written < out.size())
+			{
+				ssize_t n = ::write(STDERR_FILENO, out.data() + written, out.size() - written);
+				if (n < 0 && errno == EINTR)
+					continue;
+				if (n <= 0)
+					return;
+				written += n;
+			}
+		}
+
+		std::mutex mtx;
+		std::condition_variable cv;
+		std::condition_variable done;
+		std::vector<Ring *> rings;
+		uint64_t passes = 0;
+		bool stopping = false;
+		std::thread flusher;
+};
+
+// The process' logger (never destroyed, threads may still log while the process exits)
+inline Logger &logger()
+{
+	static Logger *l = new Logger();
+	return *l;
+}
+
+inline bool logEnabled(LogLevel level)
+{
+	return logger().enabled(level);
+}
+
+inline void logWrite(LogLevel level, const char *event, uint64_t suppressed, const char *format, ...)
+	__attribute__((format(printf, 4, 5)));
+inline void logWrite(LogLevel level, const char *event, uint64_t suppressed, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	logger().write(level, event, suppressed, format, args);
+	va_end(args);
+}
+
+// Set the level and let SIGUSR1/SIGUSR2 make it more/less verbose
+inline void logSetup(LogLevel level)
+{
+	logger().level.store(level);
+	struct sigaction sa;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_flags = SA_RESTART;
+	sa.sa_handler = [](int sig)
+	{
+		// (lock-free atomics are safe in a signal handler; the flusher reports the change)
+		std::atomic<int> &l = logger().level;
+		int current = l.load();
+		l.store(sig == SIGUSR1 ? std::max((int) LOG_DEBUG, current - 1) : std::min((int) LOG_OFF, current + 1));
+	};
+	sigaction(SIGUSR1, &sa, NULL);
+	sigaction(SIGUSR2, &sa, NULL);
+}
+
+// At most one line per interval from the call site, with the number held back since the last one
+class LogLimit
+{
+	public:
+		explicit LogLimit(int interval_ms) : interval_ns(interval_ms * 1000000LL) {}
+
+		bool allow(uint64_t &suppressed)
+		{
+			struct timespec now;
+			clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+			int64_t now_ns = now.tv_sec * 1000000000LL + now.tv_nsec;
+			int64_t next = next_ns.load(std::memory_order_relaxed);
+			if (now_ns < next || !next_ns.compare_exchange_strong(next, now_ns + interval_ns))
+			{
+				held_back.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			suppressed = held_back.exchange(0, std::memory_order_relaxed);
+			return true;
+		}
+
+	private:
+		int64_t interval_ns;
+		std::atomic<int64_t> next_ns{0};
+		std::atomic<uint64_t> held_back{0};
+};
+
+// LOG(LOG_INFO, "event_name", "key=%s count=%d", value, count), or LOG(LOG_INFO, "event_name")
+// (the format must be a literal)
+#define LOG(level, event, ...) \
+	do \
+	{ \
+		if (logEnabled(level)) \
+			logWrite(level, event, 0, " " __VA_ARGS__); \
+	} while (0)
+
+#define LOG_EVERY_MS(level, interval_ms, event, ...) \
+	do \
+	{ \
+		static LogLimit log_limit(interval_ms); \
+		uint64_t log_suppressed = 0; \
+		if (logEnabled(level) && log_limit.allow(log_suppressed)) \
+			logWrite(level, event, log_suppressed, " " __VA_ARGS__); \
+	} while (0)
+
+#endif
@@ -0,0 +1,288 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Lock-free metrics registry, exported in the Prometheus text format.
+ *
+ * Metrics are declared as globals and register themselves on construction.
+ * Updates are relaxed atomic adds to a shard owned by the calling thread
+ * (one cache line per shard), so hot paths never contend or take a lock;
+ * shards are only summed when the metrics page is rendered.
+ */
+
+#define METRIC_SHARDS 16
+
+// Index of the calling thread's shard, handed out round-robin on first use
+inline unsigned metricShard()
+{
+	static std::atomic<unsigned> next_shard(0);
+	static thread_local unsigned shard = next_shard++ % METRIC_SHARDS;
+	return shard;
+}
+
+class Metric;
+
+// Every metric in the process, in registration order
+inline std::vector<Metric *> &metricRegistry()
+{
+	static std::vector<Metric *> registry;
+	return registry;
+}
+
+inline std::mutex &metricRegistryMutex()
+{
+	static std::mutex mtx;
+	return mtx;
+}
+
+class Metric
+{
+	public:
+		Metric(const std::string &name, const std::string &help, const std::string &labels, const char *type)
+			: name(name), help(help), labels(labels), type(type)
+		{
+			std::lock_guard<std::mutex> lock(metricRegistryMutex());
+			metricRegistry().push_back(this);
+		}
+		virtual ~Metric() {}
+
+		// Write the sample lines of this metric (without HELP/TYPE)
+		virtual void render(std::ostream &out) const = 0;
+
+		const std::string name;
+		const std::string help;
+		const std::string labels;
+		const char *type;
+
+	protected:
+		// "name{labels}" with an optional extra label appended
+		std::string series(const std::string &suffix, const std::string &extra = "") const
+		{
+			std::string all = labels;
+			if (extra != "")
+				all += (all == "" ? "" : ",") + extra;
+			return name + suffix + (all == "" ? "" : "{" + all + "}");
+		}
+};
+
+// Monotonically increasing count
+class Counter : public Metric
+{
+	public:
+		Counter(const std::string &name, const std::string &help, const std::string &labels = "")
+			: Metric(name, help, labels, "counter") {}
+
+		void add(uint64_t n = 1)
+		{
+			shards[metricShard()].value.fetch_add(n, std::memory_order_relaxed);
+		}
+
+		uint64_t value() const
+		{
+			uint64_t total = 0;
+			for (const Shard &s : shards)
+				total += s.value.load(std::memory_order_relaxed);
+			return total;
+		}
+
+		void render(std::ostream &out) const override
+		{
+			out << series("") << " " << value() << "\n";
+		}
+
+	private:
+		struct alignas(64) Shard { std::atomic<uint64_t> value{0}; };
+		Shard shards[METRIC_SHARDS];
+};
+
+// Value that can go up and down (e.g. a pool size)
+class Gauge : public Metric
+{
+	public:
+		Gauge(const std::string &name, const std::string &help, const std::string &labels = "")
+			: Metric(name, help, labels, "gauge") {}
+
+		void set(int64_t v) { value.store(v, std::memory_order_relaxed); }
+		void add(int64_t n) { value.fetch_add(n, std::memory_order_relaxed); }
+
+		void render(std::ostream &out) const override
+		{
+			out << series("") << " " << value.load(std::memory_order_relaxed) << "\n";
+		}
+
+	private:
+		std::atomic<int64_t> value{0};
+};
+
+// Distribution of integer observations (nanoseconds, sizes, ...) in power-of-two buckets
+// Bucket b holds values below 2^b; buckets first_bucket..last_bucket are exported, with
+// their bounds multiplied by scale (e.g. 1e-9 to export nanoseconds as seconds)
+class Histogram : public Metric
+{
+	public:
+		static const int NUM_BUCKETS = 65;
+
+		Histogram(const std::string &name, const std::string &help, const std::string &labels,
+				  double scale, int first_bucket, int last_bucket)
+			: Metric(name, help, labels, "histogram"), scale(scale),
+			  first_bucket(first_bucket), last_bucket(last_bucket) {}
+
+		void record(uint64_t value)
+		{
+			Shard &s = shards[metricShard()];
+			int bucket = value == 0 ? 0 : 64 - __builtin_clzll(value);
+			s.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+			s.sum.fetch_add(value, std::memory_order_relaxed);
+		}
+
+		void render(std::ostream &out) const override
+		{
+			uint64_t counts[NUM_BUCKETS] = {0};
+			uint64_t sum = 0;
+			for (const Shard &s : shards)
+			{
+				for (int b = 0; b < NUM_BUCKETS; b++)
+					counts[b] += s.buckets[b].load(std::memory_order_relaxed);
+				sum += s.sum.load(std::memory_order_relaxed);
+			}
+
+			uint64_t cumulative = 0;
+			for (int b = 0; b < NUM_BUCKETS; b++)
+			{
+				cumulative += counts[b];
+				if (b >= first_bucket && b <= last_bucket)
+				{
+					std::ostringstream le;
+					le << "le=\"" << (double) (1ULL << b) * scale << "\"";
+					out << series("_bucket", le.str()) << " " << cumulative << "\n";
+				}
+			}
+			out << series("_bucket", "le=\"+Inf\"") << " " << cumulative << "\n";
+			out << series("_sum") << " " << sum * scale << "\n";
+			out << series("_count") << " " << cumulative << "\n";
+		}
+
+	private:
+		struct alignas(64) Shard
+		{
+			std::atomic<uint64_t> buckets[NUM_BUCKETS];
+			std::atomic<uint64_t> sum;
+			Shard() : sum(0) { for (auto &b : buckets) b.store(0); }
+		};
+		Shard shards[METRIC_SHARDS];
+		const double scale;
+		const int first_bucket;
+		const int last_bucket;
+};
+
+// Latency histogram in seconds, recorded in nanoseconds (~1us to ~68s)
+class LatencyMetric : public Histogram
+{
+	public:
+		LatencyMetric(const std::string &name, const std::string &help, const std::string &labels = "")
+			: Histogram(name, help, labels, 1e-9, 10, 36) {}
+};
+
+// Records the lifetime of the enclosing scope into a latency histogram
+class ScopedTimer
+{
+	public:
+		ScopedTimer(Histogram &histogram)
+			: histogram(histogram), start(std::chrono::steady_clock::now()) {}
+		~ScopedTimer()
+		{
+			histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - start).count());
+		}
+
+	private:
+		Histogram &histogram;
+		std::chrono::steady_clock::time_point start;
+};
+
+// Render every registered metric, grouping series that share a name under one HELP/TYPE header
+inline std::string renderMetrics()
+{
+	std::lock_guard<std::mutex> lock(metricRegistryMutex());
+	std::vector<Metric *> &registry = metricRegistry();
+	std::vector<bool> done(registry.size(), false);
+	std::ostringstream out;
+	for (size_t i = 0; i < registry.size(); i++)
+	{
+		if (done[i])
+			continue;
+		out << "# HELP " << registry[i]->name << " " << registry[i]->help << "\n";
+		out << "# TYPE " << registry[i]->name << " " << registry[i]->type << "\n";
+		for (size_t j = i; j < registry.size(); j++)
+		{
+			if (!done[j] && registry[j]->name == registry[i]->name)
+			{
+				registry[j]->render(out);
+				done[j] = true;
+			}
+		}
+	}
+	return out.str();
+}
+
+// Serve the metrics page to any HTTP request on the given port from a background thread
+inline void startMetricsServer(const std::string &port)
+{
+	int sock;
+	struct sockaddr_in addr;
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = INADDR_ANY;
+	addr.sin_port = htons(stoi(port));
+
+	int opt = 1;
+	if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0
+			|| setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, (const char *) &opt, sizeof(opt)) < 0
+			|| bind(sock, (struct sockaddr *) &addr, sizeof(addr)) < 0
+			|| listen(sock, 16) < 0)
+	{
+		std::cerr << "Could not serve metrics on port " << port << std::endl;
+		return;
+	}
+
+	std::thread([sock]() {
+		char buf[1024];
+		while (true)
+		{
+			int conn = accept(sock, NULL, NULL);
+			if (conn < 0)
+				continue;
+
+			// The request itself is irrelevant, every path returns the metrics page
+			if (read(conn, buf, sizeof(buf)) >= 0)
+			{
+				std::string body = renderMetrics();
+				std::string response = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+									   "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+				size_t sent = 0;
+				while (sent < response.size())
+				{
+					ssize_t n = send(conn, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+					if (n <= 0)
+						break;
+					sent += n;
+				}
+			}
+			close(conn);
+		}
+	}).detach();
+}
+
+#endif
@@ -0,0 +1,139 @@
+#ifndef PRESENCE_H
+#define PRESENCE_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <grpc++/grpc++.h>
+
+#include "sns.grpc.pb.h"
+
+/*
+ * Presence index of the master (tsdm): which users currently have a
+ * timeline stream open, and the stream to deliver their posts on.
+ *
+ * Users enter the index when their stream opens and leave it when the
+ * stream ends, so fan-out only writes to streams that are really there;
+ * everyone else gets the post from storage when they next read.
+ */
+
+struct Client;
+
+// An open timeline stream. Writes are serialized, since the stream's own handler
+// (acks, replay) and the fan-out of other users' posts write to it concurrently
+class LiveStream
+{
+	public:
+		LiveStream(grpc::ServerReaderWriter<csce438::Message, csce438::Message> *stream) : stream(stream) {}
+
+		// Returns false if the stream is closed or the write failed
+		bool write(const csce438::Message &message)
+		{
+			return write(&message, 1);
+		}
+
+		// Write several messages, flushed together after the last one
+		bool write(const csce438::Message *messages, size_t count)
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			return writeLocked(messages, count);
+		}
+
+		// Write the messages fill() gives, holding the stream meanwhile: messages other threads write
+		// while fill() runs (e.g. live posts, once it has registered the stream) go out after them
+		bool replay(const std::function<void(std::vector<csce438::Message> &)> &fill)
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			std::vector<csce438::Message> messages;
+			fill(messages);
+			return writeLocked(messages.data(), messages.size());
+		}
+
+		// Called before the stream's handler returns, no write touches the stream afterwards
+		void close()
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			closed = true;
+		}
+
+	private:
+		bool writeLocked(const csce438::Message *messages, size_t count)
+		{
+			for (size_t i = 0; i < count && !closed; i++)
+			{
+				grpc::WriteOptions options;
+				if (i + 1 < count)
+					options.set_buffer_hint();
+				if (!stream->Write(messages[i], options))
+					closed = true;
+			}
+			return !closed;
+		}
+
+		std::mutex mtx;
+		grpc::ServerReaderWriter<csce438::Message, csce438::Message> *stream;
+		bool closed = false;
+};
+
+class Presence
+{
+	public:
+		// Register the user's stream, replacing any older one (e.g. after a reconnect)
+		void enter(const Client *user, const std::shared_ptr<LiveStream> &stream)
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			live[user] = stream;
+		}
+
+		// Remove the user, unless a newer stream has replaced the given one
+		void leave(const Client *user, const std::shared_ptr<LiveStream> &stream)
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			auto it = live.find(user);
+			if (it != live.end() && it->second == stream)
+				live.erase(it);
+		}
+
+		// Look up the streams of a list of users in one pass; streams[i] is empty if users[i] is offline
+		// Returns the number of users that are present
+		size_t collect(const std::vector<Client *> &users, std::vector<std::shared_ptr<LiveStream>> &streams)
+		{
+			streams.assign(users.size(), std::shared_ptr<LiveStream>());
+			size_t present = 0;
+			std::lock_guard<std::mutex> lock(mtx);
+			if (live.empty())
+				return 0;
+			for (size_t i = 0; i < users.size(); i++)
+			{
+				auto it = live.find(users[i]);
+				if (it != live.end())
+				{
+					streams[i] = it->second;
+					present++;
+				}
+			}
+			return present;
+		}
+
+		// Every open stream
+		void all(std::vector<std::shared_ptr<LiveStream>> &streams)
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			for (auto &entry : live)
+				streams.push_back(entry.second);
+		}
+
+		size_t size()
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			return live.size();
+		}
+
+	private:
+		std::mutex mtx;
+		std::unordered_map<const Client *, std::shared_ptr<LiveStream>> live;
+};
+
+#endif
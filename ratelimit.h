@@ -0,0 +1,132 @@
+#ifndef RATELIMIT_H
+#define RATELIMIT_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+/*
+ * Admission control for the master (tsdm).
+ *
+ * Per-user rate limits are token buckets implemented with the generic cell
+ * rate algorithm: a bucket is a single "theoretical arrival time" that is
+ * advanced by one emission interval per admitted request with a CAS, so a
+ * decision is a clock read and one or two atomic operations, with no lock.
+ * The limit itself (rate and burst) is shared by every bucket of a kind.
+ *
+ * The in-flight budget bounds how many requests the whole server works on
+ * at once, so overload is shed at the door instead of slowing everyone down.
+ */
+
+// Current time on the monotonic clock in nanoseconds
+inline int64_t monotonicNanos()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Rate and burst of a kind of request, shared by every bucket of that kind
+struct RateLimit
+{
+	int64_t interval_ns = 0;	// Time that earns one token (0 for unlimited)
+	int64_t tolerance_ns = 0;	// How far ahead of schedule a bucket may run (burst - 1 intervals)
+
+	RateLimit() {}
+	RateLimit(double per_second, double burst)
+	{
+		if (per_second > 0)
+		{
+			interval_ns = (int64_t) (1e9 / per_second);
+			tolerance_ns = (int64_t) (interval_ns * (burst > 1 ? burst - 1 : 0));
+		}
+	}
+};
+
+class TokenBucket
+{
+	public:
+		TokenBucket() {}
+		// Buckets live in copyable structs (the user registry), copy the current state
+		TokenBucket(const TokenBucket &other) : tat(other.tat.load(std::memory_order_relaxed)) {}
+		TokenBucket &operator=(const TokenBucket &other)
+		{
+			tat.store(other.tat.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			return *this;
+		}
+
+		// Take a token at time now (monotonicNanos())
+		// Returns true if the request is admitted, otherwise false with the time until a token is available
+		bool admit(const RateLimit &limit, int64_t now, int64_t &retry_after_ns)
+		{
+			if (limit.interval_ns == 0)
+				return true;
+			int64_t current = tat.load(std::memory_order_relaxed);
+			while (true)
+			{
+				int64_t start = current > now ? current : now;
+				int64_t next = start + limit.interval_ns;
+				if (start - now > limit.tolerance_ns)
+				{
+					retry_after_ns = start - now - limit.tolerance_ns;
+					return false;
+				}
+				if (tat.compare_exchange_weak(current, next, std::memory_order_relaxed))
+					return true;
+			}
+		}
+
+	private:
+		std::atomic<int64_t> tat{0};
+};
+
+// Bound on the number of requests being handled at once
+class InflightBudget
+{
+	public:
+		explicit InflightBudget(int limit = 0) : limit(limit) {}
+
+		void setLimit(int l) { limit = l; }
+
+		// Claim a slot, false if the budget is exhausted (a limit of 0 is unlimited)
+		bool enter()
+		{
+			if (limit == 0)
+				return true;
+			if (inflight.fetch_add(1, std::memory_order_relaxed) >= limit)
+			{
+				inflight.fetch_sub(1, std::memory_order_relaxed);
+				return false;
+			}
+			return true;
+		}
+
+		void leave()
+		{
+			if (limit != 0)
+				inflight.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<int> inflight{0};
+		int limit;
+};
+
+// Holds a slot of an in-flight budget for the lifetime of the enclosing scope, if one was free
+class InflightGuard
+{
+	public:
+		InflightGuard(InflightBudget &budget) : budget(budget), admitted(budget.enter()) {}
+		~InflightGuard()
+		{
+			if (admitted)
+				budget.leave();
+		}
+
+		InflightGuard(const InflightGuard &) = delete;
+		InflightGuard &operator=(const InflightGuard &) = delete;
+
+		InflightBudget &budget;
+		const bool admitted;
+};
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef REPLICATION_H
+#define REPLICATION_H
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "server.h"
+
+/*
+ * Mutation log of a master, followed by its slave running as a read replica.
+ *
+ * Posts already live in the feed files, which the replica reads directly
+ * (master and slave share a working directory). What only exists in the
+ * master's memory is the user registry and follower graph, so every change
+ * to them is appended to a log named after the master's client port, one
+ * line per change:
+ *
+ *     REGISTER user
+ *     FOLLOW user1 user2
+ *     UNFOLLOW user1 user2
+ *
+ * A master starting from scratch replaces the log (a new file, so a replica
+ * holding the old one notices and starts over); one taking over in a hot
+ * restart keeps appending to it. The replica polls the log for new lines
+ * every REPLICA_POLL_MS.
+ */
+
+// How often a replica checks the mutation log for new changes
+#define REPLICA_POLL_MS 20
+
+// Mutation log of the master serving clients on a port
+inline std::string mutationLogPath(const std::string &client_port)
+{
+	return "mutations-" + client_port + ".log";
+}
+
+// Writer side, used by the master
+class MutationLog
+{
+	public:
+		// Start a new log, or continue the existing one (hot restart)
+		void open(const std::string &client_port, bool fresh)
+		{
+			std::string path = mutationLogPath(client_port);
+			if (fresh)
+				unlink(path.c_str());
+			fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+		}
+
+		// Append one change (each line in a single write, so a replica never sees half of it for long)
+		void append(const std::string &line)
+		{
+			if (fd < 0)
+				return;
+			std::string record = line + "\n";
+			std::lock_guard<std::mutex> lock(mtx);
+			writeAll(fd, record.data(), record.size());
+		}
+
+	private:
+		int fd = -1;
+		std::mutex mtx;
+};
+
+// Reader side, used by the replica
+class MutationLogTail
+{
+	public:
+		explicit MutationLogTail(const std::string &client_port) : path(mutationLogPath(client_port)) {}
+
+		// Collect the complete lines appended since the last poll
+		// Returns true if the log was replaced (the master started from scratch), the lines then start from the top
+		bool poll(std::vector<std::string> &lines)
+		{
+			bool replaced = false;
+			struct stat current, opened;
+			if (stat(path.c_str(), &current) < 0)
+				return false;
+			if (fd >= 0 && (fstat(fd, &opened) < 0 || opened.st_ino != current.st_ino))
+			{
+				close(fd);
+				fd = -1;
+				replaced = true;
+			}
+			if (fd < 0)
+			{
+				if ((fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC)) < 0)
+					return false;
+				offset = 0;
+				partial.clear();
+			}
+
+			char buf[4096];
+			ssize_t n;
+			while ((n = pread(fd, buf, sizeof(buf), offset)) > 0)
+			{
+				offset += n;
+				partial.append(buf, n);
+			}
+			size_t start = 0, newline;
+			while ((newline = partial.find('\n', start)) != std::string::npos)
+			{
+				lines.push_back(partial.substr(start, newline - start));
+				start = newline + 1;
+			}
+			partial.erase(0, start);
+			return replaced;
+		}
+
+	private:
+		const std::string path;
+		int fd = -1;
+		off_t offset = 0;
+		std::string partial;
+};
+
+// Apply one line of the mutation log to the registry and follower graph
+inline void applyMutation(const std::string &line)
+{
+	std::istringstream words(line);
+	std::string command, username1, username2;
+	words >> command >> username1 >> username2;
+	if (command == "REGISTER" && find_user(username1) < 0)
+	{
+		Client c;
+		c.username = username1;
+		c.connected = false;
+		client_db.push_back(c);
+		return;
+	}
+	int index1 = find_user(username1), index2 = find_user(username2);
+	if (index1 < 0 || index2 < 0)
+		return;
+	if (command == "FOLLOW")
+		followUser(&client_db[index1], &client_db[index2]);
+	else if (command == "UNFOLLOW")
+		unfollowUser(&client_db[index1], &client_db[index2]);
+}
+
+#endif
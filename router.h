@@ -0,0 +1,325 @@
+#ifndef ROUTER_H
+#define ROUTER_H
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "health.h"
+#include "log.h"
+#include "metrics.h"
+
+/*
+ * Routing table of the router (tsdm in router mode) and its replication.
+ *
+ * A router can run alongside peer routers, any of which can answer client
+ * redirects. Every router periodically sends each peer the masters it has
+ * in rotation, as one line over the peer's backend port:
+ *
+ *     SYNC ip:port ip:port ...
+ *
+ * and a peer adds any master it does not know yet, so a master only has to
+ * register with one router. A router that gets a SYNC lacking masters it has
+ * answers with its own table right away, so a router that restarts (and
+ * sends its empty table on startup) is refilled as soon as it is up. Tables are merged by union; a master is
+ * only dropped everywhere when its slave reports it dead, which is forwarded
+ * to the peers as "FORGET ip:port". Each router health checks every master
+ * in its table itself, so rotation decisions never depend on a peer.
+ *
+ * A master whose slave runs as a read replica is listed as "ip:port/replica
+ * port" (the slave registers it with "REPLICA <client port> <replica port>"),
+ * and clients are sent the replica's "ip:port" after the master's.
+ */
+
+// How often the table is sent to every peer (also the retry interval for unreachable peers)
+#define SYNC_INTERVAL_MS 250
+
+extern Counter router_redirects;
+extern Counter router_unavailable;
+extern Counter router_removed;
+extern Gauge router_pool;
+extern Counter router_evicted;
+extern Counter router_restored;
+extern Counter router_synced;
+extern Counter router_syncs_sent;
+extern Gauge router_replicas;
+
+// A master known to the router, in rotation unless its health probes are failing
+struct RegisteredMaster
+{
+	uint64_t id;
+	struct sockaddr_in addr;	// Address, with the port it serves clients on (0 if unknown)
+	bool up;
+};
+
+// "ip:port" of an address
+inline std::string formatEndpoint(const struct sockaddr_in &addr)
+{
+	char ip[INET_ADDRSTRLEN];
+	if (inet_ntop(AF_INET, &addr.sin_addr, ip, INET_ADDRSTRLEN) == NULL)
+		return "";
+	return std::string(ip) + ":" + std::to_string(ntohs(addr.sin_port));
+}
+
+// Parse "ip:port", false if it is not one
+inline bool parseEndpoint(const std::string &endpoint, struct sockaddr_in &addr)
+{
+	size_t colon = endpoint.find(':');
+	if (colon == std::string::npos)
+		return false;
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(atoi(endpoint.c_str() + colon + 1));
+	return addr.sin_port != 0 && inet_pton(AF_INET, endpoint.substr(0, colon).c_str(), &addr.sin_addr) == 1;
+}
+
+class RoutingTable
+{
+	public:
+		RoutingTable(int probe_ms, int probe_failures) : health(probe_ms * 1000000LL, probe_failures) {}
+
+		// Add a master (or put a known one back into rotation) and start health checking it
+		// Returns true if the master was not known before
+		bool add(const struct sockaddr_in &addr)
+		{
+			RegisteredMaster *known = find(addr);
+			RegisteredMaster master;
+			if (known != NULL)
+			{
+				known->up = true;
+				master = *known;
+			}
+			else
+			{
+				master.id = next_id++;
+				master.addr = addr;
+				master.up = true;
+				masters.push_back(master);
+			}
+
+			// Health check masters that told us their client port
+			if (master.addr.sin_port != 0)
+			{
+				health.unwatch(master.id);
+				health.watch(master.id, formatEndpoint(master.addr));
+			}
+			router_pool.set(available());
+			return known == NULL;
+		}
+
+		// Remove the masters at an address (only the one on the given client port, if not 0)
+		// Returns the endpoints removed
+		std::vector<std::string> remove(in_addr_t ip, uint16_t port)
+		{
+			std::vector<std::string> removed;
+			for (int j = masters.size() - 1; j >= 0; j--)
+			{
+				if (masters[j].addr.sin_addr.s_addr == ip && (port == 0 || masters[j].addr.sin_port == port))
+				{
+					removed.push_back(formatEndpoint(masters[j].addr));
+					health.unwatch(masters[j].id);
+					masters.erase(masters.begin() + j);
+					router_removed.add();
+				}
+			}
+			router_pool.set(available());
+			return removed;
+		}
+
+		// Apply finished health probes, taking masters out of rotation or putting them back
+		void poll()
+		{
+			changes.clear();
+			health.poll(changes);
+			for (auto &change : changes)
+			{
+				for (RegisteredMaster &m : masters)
+				{
+					if (m.id == change.first)
+					{
+						m.up = change.second;
+						if (m.up)
+							router_restored.add();
+						else
+							router_evicted.add();
+						LOG(m.up ? LOG_INFO : LOG_WARN, m.up ? "master_restored" : "master_evicted", "master=%s", formatEndpoint(m.addr).c_str());
+					}
+				}
+				router_pool.set(available());
+			}
+		}
+
+		// Time until poll() has probes to send
+		int64_t untilNextPoll() const
+		{
+			return health.untilNextPoll();
+		}
+
+		// The first master in rotation, NULL if there is none
+		const RegisteredMaster *pick() const
+		{
+			for (const RegisteredMaster &m : masters)
+				if (m.up)
+					return &m;
+			return NULL;
+		}
+
+		// Record the read replica of the master at an address (its slave, on the same host)
+		void setReplica(const struct sockaddr_in &master, uint16_t replica_port)
+		{
+			replicas[formatEndpoint(master)] = replica_port;
+			router_replicas.set(replicas.size());
+		}
+
+		// "ip:port" of a master's read replica, "" if it has none
+		std::string replicaOf(const RegisteredMaster &master) const
+		{
+			auto it = replicas.find(formatEndpoint(master.addr));
+			if (it == replicas.end())
+				return "";
+			struct sockaddr_in replica = master.addr;
+			replica.sin_port = htons(it->second);
+			return formatEndpoint(replica);
+		}
+
+		// The table as a SYNC line (masters in rotation with a known client port only, with their replica port)
+		std::string syncMessage() const
+		{
+			std::string msg = "SYNC";
+			for (const RegisteredMaster &m : masters)
+			{
+				if (!m.up || m.addr.sin_port == 0)
+					continue;
+				std::string endpoint = formatEndpoint(m.addr);
+				msg += " " + endpoint;
+				auto replica = replicas.find(endpoint);
+				if (replica != replicas.end())
+					msg += "/" + std::to_string(replica->second);
+			}
+			return msg + "\n";
+		}
+
+		// Merge a peer's SYNC line or apply its FORGET line
+		// Returns true if the peer's table lacks masters this router has in rotation (e.g. it just restarted)
+		bool applyPeerMessage(const std::string &line)
+		{
+			std::istringstream words(line);
+			std::string command, endpoint;
+			words >> command;
+			struct sockaddr_in addr;
+			size_t known = 0;
+			while (words >> endpoint)
+			{
+				// "ip:port/replica port" for a master with a read replica
+				size_t slash = endpoint.find('/');
+				if (slash != std::string::npos)
+				{
+					uint16_t replica_port = atoi(endpoint.c_str() + slash + 1);
+					endpoint.erase(slash);
+					if (command == "SYNC" && replica_port != 0 && parseEndpoint(endpoint, addr))
+						setReplica(addr, replica_port);
+				}
+				if (!parseEndpoint(endpoint, addr))
+					continue;
+				RegisteredMaster *master = find(addr);
+				if (command == "SYNC" && master == NULL)
+				{
+					add(addr);
+					router_synced.add();
+				}
+				else if (command == "SYNC" && master->up)
+					known++;
+				else if (command == "FORGET")
+					remove(addr.sin_addr.s_addr, addr.sin_port);
+			}
+			return command == "SYNC" && known < syncable();
+		}
+
+	private:
+		RegisteredMaster *find(const struct sockaddr_in &addr)
+		{
+			for (RegisteredMaster &m : masters)
+				if (m.addr.sin_addr.s_addr == addr.sin_addr.s_addr && m.addr.sin_port == addr.sin_port)
+					return &m;
+			return NULL;
+		}
+
+		// Masters a SYNC line lists
+		size_t syncable() const
+		{
+			size_t n = 0;
+			for (const RegisteredMaster &m : masters)
+				if (m.up && m.addr.sin_port != 0)
+					n++;
+			return n;
+		}
+
+		size_t available() const
+		{
+			size_t n = 0;
+			for (const RegisteredMaster &m : masters)
+				if (m.up)
+					n++;
+			return n;
+		}
+
+		// Masters in order of preference
+		std::vector<RegisteredMaster> masters;
+		std::map<std::string, uint16_t> replicas;	// Replica port by master "ip:port"
+		uint64_t next_id = 1;
+		HealthChecker health;
+		std::vector<std::pair<uint64_t, bool>> changes;
+};
+
+// Connection to a peer router's backend port, re-established on demand
+struct RouterPeer
+{
+	std::string endpoint;
+	int sock = -1;
+};
+
+// Send a message to a peer router, connecting first if needed (never blocking for long on a dead peer)
+// Returns false (and drops the connection) if the peer cannot be reached
+inline bool sendToPeer(RouterPeer &peer, const std::string &msg)
+{
+	// Peers never send anything back, so a readable connection has been closed by a peer that died
+	// (and a send on it would only be lost)
+	char byte;
+	if (peer.sock >= 0 && (recv(peer.sock, &byte, 1, MSG_PEEK | MSG_DONTWAIT) >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)))
+	{
+		close(peer.sock);
+		peer.sock = -1;
+	}
+	if (peer.sock < 0)
+	{
+		struct sockaddr_in addr;
+		if (!parseEndpoint(peer.endpoint, addr) || (peer.sock = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+			return false;
+		struct timeval tv;
+		tv.tv_sec = 0;
+		tv.tv_usec = 100000;
+		setsockopt(peer.sock, SOL_SOCKET, SO_SNDTIMEO, (const char *) &tv, sizeof(tv));
+		if (connect(peer.sock, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		{
+			close(peer.sock);
+			peer.sock = -1;
+			return false;
+		}
+	}
+	if (send(peer.sock, msg.c_str(), msg.size(), MSG_NOSIGNAL) != (ssize_t) msg.size())
+	{
+		close(peer.sock);
+		peer.sock = -1;
+		return false;
+	}
+	return true;
+}
+
+#endif
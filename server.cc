@@ -0,0 +1,218 @@
+/*
+ * User registry and per-post storage work of the master (see server.h)
+ */
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "server.h"
+
+// Fan-out workers' metric, declared in fanout.h
+Counter fanout_dropped("tsns_fanout_dropped_total", "Live deliveries dropped because a fan-out worker's queue was full");
+
+// Logger's metric, declared in log.h (tsdm and tsds both log)
+Counter log_dropped("tsns_log_dropped_total", "Log lines dropped because the logging thread's ring was full");
+
+//Every client that has been created
+std::deque<Client> client_db;
+
+//Guards every user's client_followers and client_following (the follower graph)
+std::mutex graph_mutex;
+
+//Users with an open timeline stream
+Presence presence;
+
+// Per-user limits on posts and on follow/unfollow, and the bound on requests handled at once
+RateLimit post_limit;
+RateLimit graph_limit;
+InflightBudget inflight_budget;
+
+// Threads writing posts to followers' open streams (none: the thread handling the post does)
+FanOutPool fanout_pool;
+
+// Storage and fan-out metrics
+Counter disk_bytes_written("tsns_disk_bytes_written_total", "Bytes appended to timeline files");
+Histogram fanout_size("tsns_fanout_followers", "Followers a post was fanned out to", "", 1, 0, 20);
+Histogram fanout_live("tsns_fanout_live_followers", "Followers a post was delivered to on an open stream", "", 1, 0, 20);
+
+//Helper function used to find a Client object given its username
+int find_user(const std::string &username)
+{
+	int index = 0;
+	for (const Client &c : client_db)
+	{
+		if (c.username == username)
+			return index;
+		index++;
+	}
+	return -1;
+}
+
+// Make user1 follow user2, false if it already does
+bool followUser(Client *user1, Client *user2)
+{
+	std::lock_guard<std::mutex> lock(graph_mutex);
+	if (std::find(user1->client_following.begin(), user1->client_following.end(), user2) != user1->client_following.end())
+		return false;
+	user1->client_following.push_back(user2);
+	user2->client_followers.push_back(user1);
+	return true;
+}
+
+// Make user1 stop following user2, false if it does not follow them
+bool unfollowUser(Client *user1, Client *user2)
+{
+	std::lock_guard<std::mutex> lock(graph_mutex);
+	auto following = std::find(user1->client_following.begin(), user1->client_following.end(), user2);
+	if (following == user1->client_following.end())
+		return false;
+	user1->client_following.erase(following);
+	user2->client_followers.erase(std::find(user2->client_followers.begin(), user2->client_followers.end(), user1));
+	return true;
+}
+
+// Record a post sequence number in the client's dedup window
+SequenceCheck acceptSequence(Client *c, uint64_t seq)
+{
+	// Unsequenced posts cannot be deduplicated
+	if (seq == 0)
+		return SEQ_NEW;
+
+	// Newer than anything seen so far, slide the window forward
+	if (seq > c->seq_high)
+	{
+		uint64_t shift = seq - c->seq_high;
+		c->seq_window = (shift >= 64) ? 0 : (c->seq_window << shift);
+		c->seq_window |= 1;
+		c->seq_high = seq;
+		return SEQ_NEW;
+	}
+
+	uint64_t offset = c->seq_high - seq;
+	if (offset >= 64)
+		return SEQ_TOO_OLD;
+	if (c->seq_window & (1ULL << offset))
+		return SEQ_DUPLICATE;
+	c->seq_window |= (1ULL << offset);
+	return SEQ_NEW;
+}
+
+// Fill in the reply to a LIST request: every user, and the followers of the given user
+void buildListReply(const Client &user, csce438::ListReply *list_reply)
+{
+	for (const Client &c : client_db)
+	{
+		list_reply->add_all_users(c.username);
+	}
+	std::lock_guard<std::mutex> lock(graph_mutex);
+	std::vector<Client *>::const_iterator it;
+	for (it = user.client_followers.begin(); it != user.client_followers.end(); it++)
+	{
+		list_reply->add_followers((*it)->username);
+	}
+}
+
+// Capture the registry and follower graph for the process taking over in a hot restart
+void buildSnapshot(csce438::Snapshot *snapshot)
+{
+	std::lock_guard<std::mutex> lock(graph_mutex);
+	for (const Client &c : client_db)
+	{
+		csce438::UserState *user = snapshot->add_users();
+		user->set_username(c.username);
+		user->set_connected(c.connected);
+		user->set_seq_high(c.seq_high);
+		user->set_seq_window(c.seq_window);
+		for (const Client *followed : c.client_following)
+			user->add_following(followed->username);
+	}
+}
+
+// Rebuild the registry and follower graph from the snapshot of the process being replaced
+void restoreSnapshot(const csce438::Snapshot &snapshot)
+{
+	client_db.clear();
+	for (const csce438::UserState &user : snapshot.users())
+	{
+		Client c;
+		c.username = user.username();
+		c.connected = user.connected();
+		c.seq_high = user.seq_high();
+		c.seq_window = user.seq_window();
+		client_db.push_back(c);
+	}
+	// Link the graph once every user is in place
+	for (int i = 0; i < snapshot.users_size(); i++)
+	{
+		for (const std::string &followed : snapshot.users(i).following())
+		{
+			int index = find_user(followed);
+			if (index < 0)
+				continue;
+			client_db[i].client_following.push_back(&client_db[index]);
+			client_db[index].client_followers.push_back(&client_db[i]);
+		}
+	}
+}
+
+// Read the newest 20 posts from the people the user follows, oldest first
+// Returns false if the user has no following feed yet
+bool readNewestPosts(const Client *c, std::vector<csce438::Message> &newest_twenty)
+{
+	uint64_t next_before_post_id;
+	return readTimelinePage(followingFeedPath(c->username), 0, REPLAY_POSTS, newest_twenty, next_before_post_id);
+}
+
+// Fill in the reply to a GetTimeline request: a page of the user's following feed, oldest first
+void buildTimelinePage(const Client &user, const csce438::TimelineRequest &request, csce438::TimelinePage *page)
+{
+	size_t limit = request.limit() == 0 ? DEFAULT_PAGE_SIZE : std::min<size_t>(request.limit(), MAX_PAGE_SIZE);
+	std::vector<csce438::Message> posts;
+	uint64_t next_before_post_id;
+	readTimelinePage(followingFeedPath(user.username), request.before_post_id(), limit, posts, next_before_post_id);
+	for (csce438::Message &post : posts)
+		page->add_posts()->Swap(&post);
+	page->set_next_before_post_id(next_before_post_id);
+}
+
+// Append a post's record to each of the poster's followers' feeds, and send it to the streams
+// of the followers that are present (tagged with the id it was given in that follower's timeline)
+void fanOutPost(Client *c, const csce438::Message &message, const std::string &record)
+{
+	//The followers as of now, a follow or unfollow on another thread does not change them under us
+	std::vector<Client *> followers;
+	{
+		std::lock_guard<std::mutex> lock(graph_mutex);
+		followers = c->client_followers;
+	}
+
+	//Put the post in each of the current user's followers' following feed and their own feed, all at once
+	std::vector<std::string> following_paths, user_paths;
+	std::vector<uint64_t> post_ids;
+	for (Client *follower : followers)
+	{
+		following_paths.push_back(followingFeedPath(follower->username));
+		user_paths.push_back(userFeedPath(follower->username));
+	}
+	feedBackend()->appendFanOut(record, following_paths, user_paths, post_ids);
+	disk_bytes_written.add(followers.size() * (2 * record.size() + INDEX_ENTRY_SIZE));
+
+	//Look the streams up once the post is in the feeds: a stream opening meanwhile registers before it
+	//reads its feed, so it either replays the post or is found here
+	std::vector<std::shared_ptr<LiveStream>> streams;
+	size_t present = presence.collect(followers, streams);
+	fanout_size.record(followers.size());
+	fanout_live.record(present);
+
+	for (size_t i = 0; i < followers.size(); i++)
+	{
+		if (streams[i])
+		{
+			csce438::Message live = message;
+			live.set_post_id(post_ids[i]);
+			fanout_pool.deliver(streams[i], live);
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <grpc++/grpc++.h>
+
+#include "fanout.h"
+#include "feedio.h"
+#include "metrics.h"
+#include "presence.h"
+#include "ratelimit.h"
+#include "sns.grpc.pb.h"
+#include "storage.h"
+
+/*
+ * User registry and per-post storage work of the master (tsdm).
+ *
+ * Kept out of tsdm.cc so the hot paths of the master can be exercised on
+ * their own by the microbenchmarks (tsmicro).
+ */
+
+struct Client
+{
+	std::string username;
+	bool connected = true;
+	// Highest post sequence number received from this user, and a bitmap of
+	// which of the 64 sequence numbers up to and including it have been seen
+	uint64_t seq_high = 0;
+	uint64_t seq_window = 0;
+	// Rate limits on posts and on follow/unfollow
+	TokenBucket post_bucket;
+	TokenBucket graph_bucket;
+	std::vector<Client *> client_followers;
+	std::vector<Client *> client_following;
+
+	bool operator==(const Client &c1) const {
+		return (username == c1.username);
+	}
+};
+
+//Every client that has been created (a deque, so the Client pointers held by
+//the follower graph and by presence stay valid as users register)
+extern std::deque<Client> client_db;
+
+//Guards every user's client_followers and client_following (the follower graph)
+extern std::mutex graph_mutex;
+
+//Users with an open timeline stream
+extern Presence presence;
+
+// Per-user limits on posts and on follow/unfollow, and the bound on requests handled at once
+extern RateLimit post_limit;
+extern RateLimit graph_limit;
+extern InflightBudget inflight_budget;
+
+// Threads writing posts to followers' open streams (none: the thread handling the post does)
+extern FanOutPool fanout_pool;
+
+// Storage and fan-out metrics
+extern Counter disk_bytes_written;
+extern Histogram fanout_size;
+extern Histogram fanout_live;
+
+// Posts replayed when a timeline stream opens, and the default and largest GetTimeline page
+#define REPLAY_POSTS 20
+#define DEFAULT_PAGE_SIZE 20
+#define MAX_PAGE_SIZE 100
+
+//Helper function used to find a Client object given its username
+int find_user(const std::string &username);
+
+// Make user1 follow user2, false if it already does
+bool followUser(Client *user1, Client *user2);
+
+// Make user1 stop following user2, false if it does not follow them
+bool unfollowUser(Client *user1, Client *user2);
+
+// Outcome of checking a post's sequence number against the client's dedup window
+enum SequenceCheck
+{
+	SEQ_NEW,		// Not seen before (or unsequenced), now recorded
+	SEQ_DUPLICATE,	// Already processed
+	SEQ_TOO_OLD		// Older than the window, it may or may not have been processed
+};
+
+// Record a post sequence number in the client's dedup window
+SequenceCheck acceptSequence(Client *c, uint64_t seq);
+
+// Fill in the reply to a LIST request: every user, and the followers of the given user
+void buildListReply(const Client &user, csce438::ListReply *list_reply);
+
+// Capture the registry and follower graph for the process taking over in a hot restart
+void buildSnapshot(csce438::Snapshot *snapshot);
+
+// Rebuild the registry and follower graph from the snapshot of the process being replaced
+void restoreSnapshot(const csce438::Snapshot &snapshot);
+
+// Read the newest 20 posts from the people the user follows, oldest first
+// Returns false if the user has no following feed yet
+bool readNewestPosts(const Client *c, std::vector<csce438::Message> &newest_twenty);
+
+// Fill in the reply to a GetTimeline request: a page of the user's following feed, oldest first
+void buildTimelinePage(const Client &user, const csce438::TimelineRequest &request, csce438::TimelinePage *page);
+
+// Append a post's record to each of the poster's followers' feeds, and send it to the streams
+// of the followers that are present (tagged with the id it was given in that follower's timeline)
+void fanOutPost(Client *c, const csce438::Message &message, const std::string &record);
+
+#endif
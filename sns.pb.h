@@ -0,0 +1,2674 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: sns.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_sns_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_sns_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/timestamp.pb.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_sns_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_sns_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sns_2eproto;
+namespace csce438 {
+class ListReply;
+struct ListReplyDefaultTypeInternal;
+extern ListReplyDefaultTypeInternal _ListReply_default_instance_;
+class Message;
+struct MessageDefaultTypeInternal;
+extern MessageDefaultTypeInternal _Message_default_instance_;
+class Reply;
+struct ReplyDefaultTypeInternal;
+extern ReplyDefaultTypeInternal _Reply_default_instance_;
+class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+class Snapshot;
+struct SnapshotDefaultTypeInternal;
+extern SnapshotDefaultTypeInternal _Snapshot_default_instance_;
+class TimelinePage;
+struct TimelinePageDefaultTypeInternal;
+extern TimelinePageDefaultTypeInternal _TimelinePage_default_instance_;
+class TimelineRequest;
+struct TimelineRequestDefaultTypeInternal;
+extern TimelineRequestDefaultTypeInternal _TimelineRequest_default_instance_;
+class UserState;
+struct UserStateDefaultTypeInternal;
+extern UserStateDefaultTypeInternal _UserState_default_instance_;
+}  // namespace csce438
+PROTOBUF_NAMESPACE_OPEN
+template<> ::csce438::ListReply* Arena::CreateMaybeMessage<::csce438::ListReply>(Arena*);
+template<> ::csce438::Message* Arena::CreateMaybeMessage<::csce438::Message>(Arena*);
+template<> ::csce438::Reply* Arena::CreateMaybeMessage<::csce438::Reply>(Arena*);
+template<> ::csce438::Request* Arena::CreateMaybeMessage<::csce438::Request>(Arena*);
+template<> ::csce438::Snapshot* Arena::CreateMaybeMessage<::csce438::Snapshot>(Arena*);
+template<> ::csce438::TimelinePage* Arena::CreateMaybeMessage<::csce438::TimelinePage>(Arena*);
+template<> ::csce438::TimelineRequest* Arena::CreateMaybeMessage<::csce438::TimelineRequest>(Arena*);
+template<> ::csce438::UserState* Arena::CreateMaybeMessage<::csce438::UserState>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace csce438 {
+
+// ===================================================================
+
+class ListReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:csce438.ListReply) */ {
+ public:
+  inline ListReply() : ListReply(nullptr) {}
+  ~ListReply() override;
+  explicit PROTOBUF_CONSTEXPR ListReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListReply(const ListReply& from);
+  ListReply(ListReply&& from) noexcept
+    : ListReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ListReply& operator=(const ListReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListReply& operator=(ListReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListReply* internal_default_instance() {
+    return reinterpret_cast<const ListReply*>(
+               &_ListReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ListReply& a, ListReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListReply& from) {
+    ListReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "csce438.ListReply";
+  }
+  protected:
+  explicit ListReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAllUsersFieldNumber = 1,
+    kFollowersFieldNumber = 2,
+  };
+  // repeated string all_users = 1;
+  int all_users_size() const;
+  private:
+  int _internal_all_users_size() const;
+  public:
+  void clear_all_users();
+  const std::string& all_users(int index) const;
+  std::string* mutable_all_users(int index);
+  void set_all_users(int index, const std::string& value);
+  void set_all_users(int index, std::string&& value);
+  void set_all_users(int index, const char* value);
+  void set_all_users(int index, const char* value, size_t size);
+  std::string* add_all_users();
+  void add_all_users(const std::string& value);
+  void add_all_users(std::string&& value);
+  void add_all_users(const char* value);
+  void add_all_users(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& all_users() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_all_users();
+  private:
+  const std::string& _internal_all_users(int index) const;
+  std::string* _internal_add_all_users();
+  public:
+
+  // repeated string followers = 2;
+  int followers_size() const;
+  private:
+  int _internal_followers_size() const;
+  public:
+  void clear_followers();
+  const std::string& followers(int index) const;
+  std::string* mutable_followers(int index);
+  void set_followers(int index, const std::string& value);
+  void set_followers(int index, std::string&& value);
+  void set_followers(int index, const char* value);
+  void set_followers(int index, const char* value, size_t size);
+  std::string* add_followers();
+  void add_followers(const std::string& value);
+  void add_followers(std::string&& value);
+  void add_followers(const char* value);
+  void add_followers(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& followers() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_followers();
+  private:
+  const std::string& _internal_followers(int index) const;
+  std::string* _internal_add_followers();
+  public:
+
+  // @@protoc_insertion_point(class_scope:csce438.ListReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> all_users_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> followers_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sns_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:csce438.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "csce438.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgumentsFieldNumber = 2,
+    kUsernameFieldNumber = 1,
+  };
+  // repeated string arguments = 2;
+  int arguments_size() const;
+  private:
+  int _internal_arguments_size() const;
+  public:
+  void clear_arguments();
+  const std::string& arguments(int index) const;
+  std::string* mutable_arguments(int index);
+  void set_arguments(int index, const std::string& value);
+  void set_arguments(int index, std::string&& value);
+  void set_arguments(int index, const char* value);
+  void set_arguments(int index, const char* value, size_t size);
+  std::string* add_arguments();
+  void add_arguments(const std::string& value);
+  void add_arguments(std::string&& value);
+  void add_arguments(const char* value);
+  void add_arguments(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& arguments() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_arguments();
+  private:
+  const std::string& _internal_arguments(int index) const;
+  std::string* _internal_add_arguments();
+  public:
+
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // @@protoc_insertion_point(class_scope:csce438.Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> arguments_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sns_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Reply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:csce438.Reply) */ {
+ public:
+  inline Reply() : Reply(nullptr) {}
+  ~Reply() override;
+  explicit PROTOBUF_CONSTEXPR Reply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Reply(const Reply& from);
+  Reply(Reply&& from) noexcept
+    : Reply() {
+    *this = ::std::move(from);
+  }
+
+  inline Reply& operator=(const Reply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Reply& operator=(Reply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Reply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Reply* internal_default_instance() {
+    return reinterpret_cast<const Reply*>(
+               &_Reply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Reply& a, Reply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Reply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Reply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Reply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Reply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Reply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Reply& from) {
+    Reply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Reply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "csce438.Reply";
+  }
+  protected:
+  explicit Reply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMsgFieldNumber = 1,
+  };
+  // string msg = 1;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // @@protoc_insertion_point(class_scope:csce438.Reply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sns_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimelineRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:csce438.TimelineRequest) */ {
+ public:
+  inline TimelineRequest() : TimelineRequest(nullptr) {}
+  ~TimelineRequest() override;
+  explicit PROTOBUF_CONSTEXPR TimelineRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimelineRequest(const TimelineRequest& from);
+  TimelineRequest(TimelineRequest&& from) noexcept
+    : TimelineRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TimelineRequest& operator=(const TimelineRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimelineRequest& operator=(TimelineRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimelineRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimelineRequest* internal_default_instance() {
+    return reinterpret_cast<const TimelineRequest*>(
+               &_TimelineRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TimelineRequest& a, TimelineRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimelineRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimelineRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimelineRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimelineRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimelineRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimelineRequest& from) {
+    TimelineRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimelineRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "csce438.TimelineRequest";
+  }
+  protected:
+  explicit TimelineRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kBeforePostIdFieldNumber = 2,
+    kLimitFieldNumber = 3,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // uint64 before_post_id = 2;
+  void clear_before_post_id();
+  uint64_t before_post_id() const;
+  void set_before_post_id(uint64_t value);
+  private:
+  uint64_t _internal_before_post_id() const;
+  void _internal_set_before_post_id(uint64_t value);
+  public:
+
+  // uint32 limit = 3;
+  void clear_limit();
+  uint32_t limit() const;
+  void set_limit(uint32_t value);
+  private:
+  uint32_t _internal_limit() const;
+  void _internal_set_limit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:csce438.TimelineRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint64_t before_post_id_;
+    uint32_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sns_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimelinePage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:csce438.TimelinePage) */ {
+ public:
+  inline TimelinePage() : TimelinePage(nullptr) {}
+  ~TimelinePage() override;
+  explicit PROTOBUF_CONSTEXPR TimelinePage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimelinePage(const TimelinePage& from);
+  TimelinePage(TimelinePage&& from) noexcept
+    : TimelinePage() {
+    *this = ::std::move(from);
+  }
+
+  inline TimelinePage& operator=(const TimelinePage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimelinePage& operator=(TimelinePage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimelinePage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimelinePage* internal_default_instance() {
+    return reinterpret_cast<const TimelinePage*>(
+               &_TimelinePage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(TimelinePage& a, TimelinePage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimelinePage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimelinePage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimelinePage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimelinePage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimelinePage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimelinePage& from) {
+    TimelinePage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimelinePage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "csce438.TimelinePage";
+  }
+  protected:
+  explicit TimelinePage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPostsFieldNumber = 1,
+    kNextBeforePostIdFieldNumber = 2,
+  };
+  // repeated .csce438.Message posts = 1;
+  int posts_size() const;
+  private:
+  int _internal_posts_size() const;
+  public:
+  void clear_posts();
+  ::csce438::Message* mutable_posts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::Message >*
+      mutable_posts();
+  private:
+  const ::csce438::Message& _internal_posts(int index) const;
+  ::csce438::Message* _internal_add_posts();
+  public:
+  const ::csce438::Message& posts(int index) const;
+  ::csce438::Message* add_posts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::Message >&
+      posts() const;
+
+  // uint64 next_before_post_id = 2;
+  void clear_next_before_post_id();
+  uint64_t next_before_post_id() const;
+  void set_next_before_post_id(uint64_t value);
+  private:
+  uint64_t _internal_next_before_post_id() const;
+  void _internal_set_next_before_post_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:csce438.TimelinePage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::Message > posts_;
+    uint64_t next_before_post_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sns_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Message final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:csce438.Message) */ {
+ public:
+  inline Message() : Message(nullptr) {}
+  ~Message() override;
+  explicit PROTOBUF_CONSTEXPR Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Message(const Message& from);
+  Message(Message&& from) noexcept
+    : Message() {
+    *this = ::std::move(from);
+  }
+
+  inline Message& operator=(const Message& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Message& operator=(Message&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message* internal_default_instance() {
+    return reinterpret_cast<const Message*>(
+               &_Message_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Message& a, Message& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Message& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "csce438.Message";
+  }
+  protected:
+  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kMsgFieldNumber = 2,
+    kTimestampFieldNumber = 3,
+    kSeqFieldNumber = 4,
+    kAckFieldNumber = 5,
+    kPostIdFieldNumber = 7,
+    kOpenStreamFieldNumber = 6,
+    kReopenFieldNumber = 9,
+    kRetryAfterMsFieldNumber = 8,
+    kResyncSeqFieldNumber = 10,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string msg = 2;
+  void clear_msg();
+  const std::string& msg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msg();
+  PROTOBUF_NODISCARD std::string* release_msg();
+  void set_allocated_msg(std::string* msg);
+  private:
+  const std::string& _internal_msg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msg(const std::string& value);
+  std::string* _internal_mutable_msg();
+  public:
+
+  // .google.protobuf.Timestamp timestamp = 3;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp& timestamp() const;
+  PROTOBUF_NODISCARD ::PROTOBUF_NAMESPACE_ID::Timestamp* release_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* mutable_timestamp();
+  void set_allocated_timestamp(::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp& _internal_timestamp() const;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_timestamp();
+  public:
+  void unsafe_arena_set_allocated_timestamp(
+      ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp);
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_timestamp();
+
+  // uint64 seq = 4;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // uint64 ack = 5;
+  void clear_ack();
+  uint64_t ack() const;
+  void set_ack(uint64_t value);
+  private:
+  uint64_t _internal_ack() const;
+  void _internal_set_ack(uint64_t value);
+  public:
+
+  // uint64 post_id = 7;
+  void clear_post_id();
+  uint64_t post_id() const;
+  void set_post_id(uint64_t value);
+  private:
+  uint64_t _internal_post_id() const;
+  void _internal_set_post_id(uint64_t value);
+  public:
+
+  // bool open_stream = 6;
+  void clear_open_stream();
+  bool open_stream() const;
+  void set_open_stream(bool value);
+  private:
+  bool _internal_open_stream() const;
+  void _internal_set_open_stream(bool value);
+  public:
+
+  // bool reopen = 9;
+  void clear_reopen();
+  bool reopen() const;
+  void set_reopen(bool value);
+  private:
+  bool _internal_reopen() const;
+  void _internal_set_reopen(bool value);
+  public:
+
+  // uint32 retry_after_ms = 8;
+  void clear_retry_after_ms();
+  uint32_t retry_after_ms() const;
+  void set_retry_after_ms(uint32_t value);
+  private:
+  uint32_t _internal_retry_after_ms() const;
+  void _internal_set_retry_after_ms(uint32_t value);
+  public:
+
+  // uint64 resync_seq = 10;
+  void clear_resync_seq();
+  uint64_t resync_seq() const;
+  void set_resync_seq(uint64_t value);
+  private:
+  uint64_t _internal_resync_seq() const;
+  void _internal_set_resync_seq(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:csce438.Message)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msg_;
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp_;
+    uint64_t seq_;
+    uint64_t ack_;
+    uint64_t post_id_;
+    bool open_stream_;
+    bool reopen_;
+    uint32_t retry_after_ms_;
+    uint64_t resync_seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sns_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Snapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:csce438.Snapshot) */ {
+ public:
+  inline Snapshot() : Snapshot(nullptr) {}
+  ~Snapshot() override;
+  explicit PROTOBUF_CONSTEXPR Snapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Snapshot(const Snapshot& from);
+  Snapshot(Snapshot&& from) noexcept
+    : Snapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline Snapshot& operator=(const Snapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Snapshot& operator=(Snapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Snapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Snapshot* internal_default_instance() {
+    return reinterpret_cast<const Snapshot*>(
+               &_Snapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Snapshot& a, Snapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Snapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Snapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Snapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Snapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Snapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Snapshot& from) {
+    Snapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Snapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "csce438.Snapshot";
+  }
+  protected:
+  explicit Snapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsersFieldNumber = 1,
+  };
+  // repeated .csce438.UserState users = 1;
+  int users_size() const;
+  private:
+  int _internal_users_size() const;
+  public:
+  void clear_users();
+  ::csce438::UserState* mutable_users(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::UserState >*
+      mutable_users();
+  private:
+  const ::csce438::UserState& _internal_users(int index) const;
+  ::csce438::UserState* _internal_add_users();
+  public:
+  const ::csce438::UserState& users(int index) const;
+  ::csce438::UserState* add_users();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::UserState >&
+      users() const;
+
+  // @@protoc_insertion_point(class_scope:csce438.Snapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::UserState > users_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sns_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UserState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:csce438.UserState) */ {
+ public:
+  inline UserState() : UserState(nullptr) {}
+  ~UserState() override;
+  explicit PROTOBUF_CONSTEXPR UserState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UserState(const UserState& from);
+  UserState(UserState&& from) noexcept
+    : UserState() {
+    *this = ::std::move(from);
+  }
+
+  inline UserState& operator=(const UserState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UserState& operator=(UserState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserState* internal_default_instance() {
+    return reinterpret_cast<const UserState*>(
+               &_UserState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(UserState& a, UserState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UserState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserState& from) {
+    UserState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UserState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "csce438.UserState";
+  }
+  protected:
+  explicit UserState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFollowingFieldNumber = 3,
+    kUsernameFieldNumber = 1,
+    kSeqHighFieldNumber = 4,
+    kSeqWindowFieldNumber = 5,
+    kConnectedFieldNumber = 2,
+  };
+  // repeated string following = 3;
+  int following_size() const;
+  private:
+  int _internal_following_size() const;
+  public:
+  void clear_following();
+  const std::string& following(int index) const;
+  std::string* mutable_following(int index);
+  void set_following(int index, const std::string& value);
+  void set_following(int index, std::string&& value);
+  void set_following(int index, const char* value);
+  void set_following(int index, const char* value, size_t size);
+  std::string* add_following();
+  void add_following(const std::string& value);
+  void add_following(std::string&& value);
+  void add_following(const char* value);
+  void add_following(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& following() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_following();
+  private:
+  const std::string& _internal_following(int index) const;
+  std::string* _internal_add_following();
+  public:
+
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // uint64 seq_high = 4;
+  void clear_seq_high();
+  uint64_t seq_high() const;
+  void set_seq_high(uint64_t value);
+  private:
+  uint64_t _internal_seq_high() const;
+  void _internal_set_seq_high(uint64_t value);
+  public:
+
+  // uint64 seq_window = 5;
+  void clear_seq_window();
+  uint64_t seq_window() const;
+  void set_seq_window(uint64_t value);
+  private:
+  uint64_t _internal_seq_window() const;
+  void _internal_set_seq_window(uint64_t value);
+  public:
+
+  // bool connected = 2;
+  void clear_connected();
+  bool connected() const;
+  void set_connected(bool value);
+  private:
+  bool _internal_connected() const;
+  void _internal_set_connected(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:csce438.UserState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> following_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint64_t seq_high_;
+    uint64_t seq_window_;
+    bool connected_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sns_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ListReply
+
+// repeated string all_users = 1;
+inline int ListReply::_internal_all_users_size() const {
+  return _impl_.all_users_.size();
+}
+inline int ListReply::all_users_size() const {
+  return _internal_all_users_size();
+}
+inline void ListReply::clear_all_users() {
+  _impl_.all_users_.Clear();
+}
+inline std::string* ListReply::add_all_users() {
+  std::string* _s = _internal_add_all_users();
+  // @@protoc_insertion_point(field_add_mutable:csce438.ListReply.all_users)
+  return _s;
+}
+inline const std::string& ListReply::_internal_all_users(int index) const {
+  return _impl_.all_users_.Get(index);
+}
+inline const std::string& ListReply::all_users(int index) const {
+  // @@protoc_insertion_point(field_get:csce438.ListReply.all_users)
+  return _internal_all_users(index);
+}
+inline std::string* ListReply::mutable_all_users(int index) {
+  // @@protoc_insertion_point(field_mutable:csce438.ListReply.all_users)
+  return _impl_.all_users_.Mutable(index);
+}
+inline void ListReply::set_all_users(int index, const std::string& value) {
+  _impl_.all_users_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:csce438.ListReply.all_users)
+}
+inline void ListReply::set_all_users(int index, std::string&& value) {
+  _impl_.all_users_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:csce438.ListReply.all_users)
+}
+inline void ListReply::set_all_users(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.all_users_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:csce438.ListReply.all_users)
+}
+inline void ListReply::set_all_users(int index, const char* value, size_t size) {
+  _impl_.all_users_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:csce438.ListReply.all_users)
+}
+inline std::string* ListReply::_internal_add_all_users() {
+  return _impl_.all_users_.Add();
+}
+inline void ListReply::add_all_users(const std::string& value) {
+  _impl_.all_users_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:csce438.ListReply.all_users)
+}
+inline void ListReply::add_all_users(std::string&& value) {
+  _impl_.all_users_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:csce438.ListReply.all_users)
+}
+inline void ListReply::add_all_users(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.all_users_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:csce438.ListReply.all_users)
+}
+inline void ListReply::add_all_users(const char* value, size_t size) {
+  _impl_.all_users_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:csce438.ListReply.all_users)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ListReply::all_users() const {
+  // @@protoc_insertion_point(field_list:csce438.ListReply.all_users)
+  return _impl_.all_users_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ListReply::mutable_all_users() {
+  // @@protoc_insertion_point(field_mutable_list:csce438.ListReply.all_users)
+  return &_impl_.all_users_;
+}
+
+// repeated string followers = 2;
+inline int ListReply::_internal_followers_size() const {
+  return _impl_.followers_.size();
+}
+inline int ListReply::followers_size() const {
+  return _internal_followers_size();
+}
+inline void ListReply::clear_followers() {
+  _impl_.followers_.Clear();
+}
+inline std::string* ListReply::add_followers() {
+  std::string* _s = _internal_add_followers();
+  // @@protoc_insertion_point(field_add_mutable:csce438.ListReply.followers)
+  return _s;
+}
+inline const std::string& ListReply::_internal_followers(int index) const {
+  return _impl_.followers_.Get(index);
+}
+inline const std::string& ListReply::followers(int index) const {
+  // @@protoc_insertion_point(field_get:csce438.ListReply.followers)
+  return _internal_followers(index);
+}
+inline std::string* ListReply::mutable_followers(int index) {
+  // @@protoc_insertion_point(field_mutable:csce438.ListReply.followers)
+  return _impl_.followers_.Mutable(index);
+}
+inline void ListReply::set_followers(int index, const std::string& value) {
+  _impl_.followers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:csce438.ListReply.followers)
+}
+inline void ListReply::set_followers(int index, std::string&& value) {
+  _impl_.followers_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:csce438.ListReply.followers)
+}
+inline void ListReply::set_followers(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.followers_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:csce438.ListReply.followers)
+}
+inline void ListReply::set_followers(int index, const char* value, size_t size) {
+  _impl_.followers_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:csce438.ListReply.followers)
+}
+inline std::string* ListReply::_internal_add_followers() {
+  return _impl_.followers_.Add();
+}
+inline void ListReply::add_followers(const std::string& value) {
+  _impl_.followers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:csce438.ListReply.followers)
+}
+inline void ListReply::add_followers(std::string&& value) {
+  _impl_.followers_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:csce438.ListReply.followers)
+}
+inline void ListReply::add_followers(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.followers_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:csce438.ListReply.followers)
+}
+inline void ListReply::add_followers(const char* value, size_t size) {
+  _impl_.followers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:csce438.ListReply.followers)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ListReply::followers() const {
+  // @@protoc_insertion_point(field_list:csce438.ListReply.followers)
+  return _impl_.followers_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ListReply::mutable_followers() {
+  // @@protoc_insertion_point(field_mutable_list:csce438.ListReply.followers)
+  return &_impl_.followers_;
+}
+
+// -------------------------------------------------------------------
+
+// Request
+
+// string username = 1;
+inline void Request::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& Request::username() const {
+  // @@protoc_insertion_point(field_get:csce438.Request.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:csce438.Request.username)
+}
+inline std::string* Request::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:csce438.Request.username)
+  return _s;
+}
+inline const std::string& Request::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void Request::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_username() {
+  // @@protoc_insertion_point(field_release:csce438.Request.username)
+  return _impl_.username_.Release();
+}
+inline void Request::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:csce438.Request.username)
+}
+
+// repeated string arguments = 2;
+inline int Request::_internal_arguments_size() const {
+  return _impl_.arguments_.size();
+}
+inline int Request::arguments_size() const {
+  return _internal_arguments_size();
+}
+inline void Request::clear_arguments() {
+  _impl_.arguments_.Clear();
+}
+inline std::string* Request::add_arguments() {
+  std::string* _s = _internal_add_arguments();
+  // @@protoc_insertion_point(field_add_mutable:csce438.Request.arguments)
+  return _s;
+}
+inline const std::string& Request::_internal_arguments(int index) const {
+  return _impl_.arguments_.Get(index);
+}
+inline const std::string& Request::arguments(int index) const {
+  // @@protoc_insertion_point(field_get:csce438.Request.arguments)
+  return _internal_arguments(index);
+}
+inline std::string* Request::mutable_arguments(int index) {
+  // @@protoc_insertion_point(field_mutable:csce438.Request.arguments)
+  return _impl_.arguments_.Mutable(index);
+}
+inline void Request::set_arguments(int index, const std::string& value) {
+  _impl_.arguments_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:csce438.Request.arguments)
+}
+inline void Request::set_arguments(int index, std::string&& value) {
+  _impl_.arguments_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:csce438.Request.arguments)
+}
+inline void Request::set_arguments(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.arguments_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:csce438.Request.arguments)
+}
+inline void Request::set_arguments(int index, const char* value, size_t size) {
+  _impl_.arguments_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:csce438.Request.arguments)
+}
+inline std::string* Request::_internal_add_arguments() {
+  return _impl_.arguments_.Add();
+}
+inline void Request::add_arguments(const std::string& value) {
+  _impl_.arguments_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:csce438.Request.arguments)
+}
+inline void Request::add_arguments(std::string&& value) {
+  _impl_.arguments_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:csce438.Request.arguments)
+}
+inline void Request::add_arguments(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.arguments_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:csce438.Request.arguments)
+}
+inline void Request::add_arguments(const char* value, size_t size) {
+  _impl_.arguments_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:csce438.Request.arguments)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Request::arguments() const {
+  // @@protoc_insertion_point(field_list:csce438.Request.arguments)
+  return _impl_.arguments_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Request::mutable_arguments() {
+  // @@protoc_insertion_point(field_mutable_list:csce438.Request.arguments)
+  return &_impl_.arguments_;
+}
+
+// -------------------------------------------------------------------
+
+// Reply
+
+// string msg = 1;
+inline void Reply::clear_msg() {
+  _impl_.msg_.ClearToEmpty();
+}
+inline const std::string& Reply::msg() const {
+  // @@protoc_insertion_point(field_get:csce438.Reply.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Reply::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:csce438.Reply.msg)
+}
+inline std::string* Reply::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:csce438.Reply.msg)
+  return _s;
+}
+inline const std::string& Reply::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void Reply::_internal_set_msg(const std::string& value) {
+  
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Reply::_internal_mutable_msg() {
+  
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Reply::release_msg() {
+  // @@protoc_insertion_point(field_release:csce438.Reply.msg)
+  return _impl_.msg_.Release();
+}
+inline void Reply::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:csce438.Reply.msg)
+}
+
+// -------------------------------------------------------------------
+
+// TimelineRequest
+
+// string username = 1;
+inline void TimelineRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& TimelineRequest::username() const {
+  // @@protoc_insertion_point(field_get:csce438.TimelineRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TimelineRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:csce438.TimelineRequest.username)
+}
+inline std::string* TimelineRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:csce438.TimelineRequest.username)
+  return _s;
+}
+inline const std::string& TimelineRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void TimelineRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TimelineRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TimelineRequest::release_username() {
+  // @@protoc_insertion_point(field_release:csce438.TimelineRequest.username)
+  return _impl_.username_.Release();
+}
+inline void TimelineRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:csce438.TimelineRequest.username)
+}
+
+// uint64 before_post_id = 2;
+inline void TimelineRequest::clear_before_post_id() {
+  _impl_.before_post_id_ = uint64_t{0u};
+}
+inline uint64_t TimelineRequest::_internal_before_post_id() const {
+  return _impl_.before_post_id_;
+}
+inline uint64_t TimelineRequest::before_post_id() const {
+  // @@protoc_insertion_point(field_get:csce438.TimelineRequest.before_post_id)
+  return _internal_before_post_id();
+}
+inline void TimelineRequest::_internal_set_before_post_id(uint64_t value) {
+  
+  _impl_.before_post_id_ = value;
+}
+inline void TimelineRequest::set_before_post_id(uint64_t value) {
+  _internal_set_before_post_id(value);
+  // @@protoc_insertion_point(field_set:csce438.TimelineRequest.before_post_id)
+}
+
+// uint32 limit = 3;
+inline void TimelineRequest::clear_limit() {
+  _impl_.limit_ = 0u;
+}
+inline uint32_t TimelineRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t TimelineRequest::limit() const {
+  // @@protoc_insertion_point(field_get:csce438.TimelineRequest.limit)
+  return _internal_limit();
+}
+inline void TimelineRequest::_internal_set_limit(uint32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void TimelineRequest::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:csce438.TimelineRequest.limit)
+}
+
+// -------------------------------------------------------------------
+
+// TimelinePage
+
+// repeated .csce438.Message posts = 1;
+inline int TimelinePage::_internal_posts_size() const {
+  return _impl_.posts_.size();
+}
+inline int TimelinePage::posts_size() const {
+  return _internal_posts_size();
+}
+inline void TimelinePage::clear_posts() {
+  _impl_.posts_.Clear();
+}
+inline ::csce438::Message* TimelinePage::mutable_posts(int index) {
+  // @@protoc_insertion_point(field_mutable:csce438.TimelinePage.posts)
+  return _impl_.posts_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::Message >*
+TimelinePage::mutable_posts() {
+  // @@protoc_insertion_point(field_mutable_list:csce438.TimelinePage.posts)
+  return &_impl_.posts_;
+}
+inline const ::csce438::Message& TimelinePage::_internal_posts(int index) const {
+  return _impl_.posts_.Get(index);
+}
+inline const ::csce438::Message& TimelinePage::posts(int index) const {
+  // @@protoc_insertion_point(field_get:csce438.TimelinePage.posts)
+  return _internal_posts(index);
+}
+inline ::csce438::Message* TimelinePage::_internal_add_posts() {
+  return _impl_.posts_.Add();
+}
+inline ::csce438::Message* TimelinePage::add_posts() {
+  ::csce438::Message* _add = _internal_add_posts();
+  // @@protoc_insertion_point(field_add:csce438.TimelinePage.posts)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::Message >&
+TimelinePage::posts() const {
+  // @@protoc_insertion_point(field_list:csce438.TimelinePage.posts)
+  return _impl_.posts_;
+}
+
+// uint64 next_before_post_id = 2;
+inline void TimelinePage::clear_next_before_post_id() {
+  _impl_.next_before_post_id_ = uint64_t{0u};
+}
+inline uint64_t TimelinePage::_internal_next_before_post_id() const {
+  return _impl_.next_before_post_id_;
+}
+inline uint64_t TimelinePage::next_before_post_id() const {
+  // @@protoc_insertion_point(field_get:csce438.TimelinePage.next_before_post_id)
+  return _internal_next_before_post_id();
+}
+inline void TimelinePage::_internal_set_next_before_post_id(uint64_t value) {
+  
+  _impl_.next_before_post_id_ = value;
+}
+inline void TimelinePage::set_next_before_post_id(uint64_t value) {
+  _internal_set_next_before_post_id(value);
+  // @@protoc_insertion_point(field_set:csce438.TimelinePage.next_before_post_id)
+}
+
+// -------------------------------------------------------------------
+
+// Message
+
+// string username = 1;
+inline void Message::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& Message::username() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:csce438.Message.username)
+}
+inline std::string* Message::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:csce438.Message.username)
+  return _s;
+}
+inline const std::string& Message::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void Message::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_username() {
+  // @@protoc_insertion_point(field_release:csce438.Message.username)
+  return _impl_.username_.Release();
+}
+inline void Message::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:csce438.Message.username)
+}
+
+// string msg = 2;
+inline void Message::clear_msg() {
+  _impl_.msg_.ClearToEmpty();
+}
+inline const std::string& Message::msg() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.msg)
+  return _internal_msg();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_msg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msg_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:csce438.Message.msg)
+}
+inline std::string* Message::mutable_msg() {
+  std::string* _s = _internal_mutable_msg();
+  // @@protoc_insertion_point(field_mutable:csce438.Message.msg)
+  return _s;
+}
+inline const std::string& Message::_internal_msg() const {
+  return _impl_.msg_.Get();
+}
+inline void Message::_internal_set_msg(const std::string& value) {
+  
+  _impl_.msg_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_msg() {
+  
+  return _impl_.msg_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_msg() {
+  // @@protoc_insertion_point(field_release:csce438.Message.msg)
+  return _impl_.msg_.Release();
+}
+inline void Message::set_allocated_msg(std::string* msg) {
+  if (msg != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.msg_.SetAllocated(msg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msg_.IsDefault()) {
+    _impl_.msg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:csce438.Message.msg)
+}
+
+// .google.protobuf.Timestamp timestamp = 3;
+inline bool Message::_internal_has_timestamp() const {
+  return this != internal_default_instance() && _impl_.timestamp_ != nullptr;
+}
+inline bool Message::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& Message::_internal_timestamp() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.timestamp_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& Message::timestamp() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.timestamp)
+  return _internal_timestamp();
+}
+inline void Message::unsafe_arena_set_allocated_timestamp(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timestamp_);
+  }
+  _impl_.timestamp_ = timestamp;
+  if (timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:csce438.Message.timestamp)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* Message::release_timestamp() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* Message::unsafe_arena_release_timestamp() {
+  // @@protoc_insertion_point(field_release:csce438.Message.timestamp)
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* Message::_internal_mutable_timestamp() {
+  
+  if (_impl_.timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.timestamp_ = p;
+  }
+  return _impl_.timestamp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* Message::mutable_timestamp() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_timestamp();
+  // @@protoc_insertion_point(field_mutable:csce438.Message.timestamp)
+  return _msg;
+}
+inline void Message::set_allocated_timestamp(::PROTOBUF_NAMESPACE_ID::Timestamp* timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timestamp_);
+  }
+  if (timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(timestamp));
+    if (message_arena != submessage_arena) {
+      timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.timestamp_ = timestamp;
+  // @@protoc_insertion_point(field_set_allocated:csce438.Message.timestamp)
+}
+
+// uint64 seq = 4;
+inline void Message::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t Message::seq() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.seq)
+  return _internal_seq();
+}
+inline void Message::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void Message::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:csce438.Message.seq)
+}
+
+// uint64 ack = 5;
+inline void Message::clear_ack() {
+  _impl_.ack_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_ack() const {
+  return _impl_.ack_;
+}
+inline uint64_t Message::ack() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.ack)
+  return _internal_ack();
+}
+inline void Message::_internal_set_ack(uint64_t value) {
+  
+  _impl_.ack_ = value;
+}
+inline void Message::set_ack(uint64_t value) {
+  _internal_set_ack(value);
+  // @@protoc_insertion_point(field_set:csce438.Message.ack)
+}
+
+// bool open_stream = 6;
+inline void Message::clear_open_stream() {
+  _impl_.open_stream_ = false;
+}
+inline bool Message::_internal_open_stream() const {
+  return _impl_.open_stream_;
+}
+inline bool Message::open_stream() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.open_stream)
+  return _internal_open_stream();
+}
+inline void Message::_internal_set_open_stream(bool value) {
+  
+  _impl_.open_stream_ = value;
+}
+inline void Message::set_open_stream(bool value) {
+  _internal_set_open_stream(value);
+  // @@protoc_insertion_point(field_set:csce438.Message.open_stream)
+}
+
+// uint64 post_id = 7;
+inline void Message::clear_post_id() {
+  _impl_.post_id_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_post_id() const {
+  return _impl_.post_id_;
+}
+inline uint64_t Message::post_id() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.post_id)
+  return _internal_post_id();
+}
+inline void Message::_internal_set_post_id(uint64_t value) {
+  
+  _impl_.post_id_ = value;
+}
+inline void Message::set_post_id(uint64_t value) {
+  _internal_set_post_id(value);
+  // @@protoc_insertion_point(field_set:csce438.Message.post_id)
+}
+
+// uint32 retry_after_ms = 8;
+inline void Message::clear_retry_after_ms() {
+  _impl_.retry_after_ms_ = 0u;
+}
+inline uint32_t Message::_internal_retry_after_ms() const {
+  return _impl_.retry_after_ms_;
+}
+inline uint32_t Message::retry_after_ms() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.retry_after_ms)
+  return _internal_retry_after_ms();
+}
+inline void Message::_internal_set_retry_after_ms(uint32_t value) {
+  
+  _impl_.retry_after_ms_ = value;
+}
+inline void Message::set_retry_after_ms(uint32_t value) {
+  _internal_set_retry_after_ms(value);
+  // @@protoc_insertion_point(field_set:csce438.Message.retry_after_ms)
+}
+
+// bool reopen = 9;
+inline void Message::clear_reopen() {
+  _impl_.reopen_ = false;
+}
+inline bool Message::_internal_reopen() const {
+  return _impl_.reopen_;
+}
+inline bool Message::reopen() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.reopen)
+  return _internal_reopen();
+}
+inline void Message::_internal_set_reopen(bool value) {
+  
+  _impl_.reopen_ = value;
+}
+inline void Message::set_reopen(bool value) {
+  _internal_set_reopen(value);
+  // @@protoc_insertion_point(field_set:csce438.Message.reopen)
+}
+
+// uint64 resync_seq = 10;
+inline void Message::clear_resync_seq() {
+  _impl_.resync_seq_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_resync_seq() const {
+  return _impl_.resync_seq_;
+}
+inline uint64_t Message::resync_seq() const {
+  // @@protoc_insertion_point(field_get:csce438.Message.resync_seq)
+  return _internal_resync_seq();
+}
+inline void Message::_internal_set_resync_seq(uint64_t value) {
+  
+  _impl_.resync_seq_ = value;
+}
+inline void Message::set_resync_seq(uint64_t value) {
+  _internal_set_resync_seq(value);
+  // @@protoc_insertion_point(field_set:csce438.Message.resync_seq)
+}
+
+// -------------------------------------------------------------------
+
+// Snapshot
+
+// repeated .csce438.UserState users = 1;
+inline int Snapshot::_internal_users_size() const {
+  return _impl_.users_.size();
+}
+inline int Snapshot::users_size() const {
+  return _internal_users_size();
+}
+inline void Snapshot::clear_users() {
+  _impl_.users_.Clear();
+}
+inline ::csce438::UserState* Snapshot::mutable_users(int index) {
+  // @@protoc_insertion_point(field_mutable:csce438.Snapshot.users)
+  return _impl_.users_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::UserState >*
+Snapshot::mutable_users() {
+  // @@protoc_insertion_point(field_mutable_list:csce438.Snapshot.users)
+  return &_impl_.users_;
+}
+inline const ::csce438::UserState& Snapshot::_internal_users(int index) const {
+  return _impl_.users_.Get(index);
+}
+inline const ::csce438::UserState& Snapshot::users(int index) const {
+  // @@protoc_insertion_point(field_get:csce438.Snapshot.users)
+  return _internal_users(index);
+}
+inline ::csce438::UserState* Snapshot::_internal_add_users() {
+  return _impl_.users_.Add();
+}
+inline ::csce438::UserState* Snapshot::add_users() {
+  ::csce438::UserState* _add = _internal_add_users();
+  // @@protoc_insertion_point(field_add:csce438.Snapshot.users)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::csce438::UserState >&
+Snapshot::users() const {
+  // @@protoc_insertion_point(field_list:csce438.Snapshot.users)
+  return _impl_.users_;
+}
+
+// -------------------------------------------------------------------
+
+// UserState
+
+// string username = 1;
+inline void UserState::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UserState::username() const {
+  // @@protoc_insertion_point(field_get:csce438.UserState.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserState::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:csce438.UserState.username)
+}
+inline std::string* UserState::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:csce438.UserState.username)
+  return _s;
+}
+inline const std::string& UserState::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UserState::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserState::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserState::release_username() {
+  // @@protoc_insertion_point(field_release:csce438.UserState.username)
+  return _impl_.username_.Release();
+}
+inline void UserState::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:csce438.UserState.username)
+}
+
+// bool connected = 2;
+inline void UserState::clear_connected() {
+  _impl_.connected_ = false;
+}
+inline bool UserState::_internal_connected() const {
+  return _impl_.connected_;
+}
+inline bool UserState::connected() const {
+  // @@protoc_insertion_point(field_get:csce438.UserState.connected)
+  return _internal_connected();
+}
+inline void UserState::_internal_set_connected(bool value) {
+  
+  _impl_.connected_ = value;
+}
+inline void UserState::set_connected(bool value) {
+  _internal_set_connected(value);
+  // @@protoc_insertion_point(field_set:csce438.UserState.connected)
+}
+
+// repeated string following = 3;
+inline int UserState::_internal_following_size() const {
+  return _impl_.following_.size();
+}
+inline int UserState::following_size() const {
+  return _internal_following_size();
+}
+inline void UserState::clear_following() {
+  _impl_.following_.Clear();
+}
+inline std::string* UserState::add_following() {
+  std::string* _s = _internal_add_following();
+  // @@protoc_insertion_point(field_add_mutable:csce438.UserState.following)
+  return _s;
+}
+inline const std::string& UserState::_internal_following(int index) const {
+  return _impl_.following_.Get(index);
+}
+inline const std::string& UserState::following(int index) const {
+  // @@protoc_insertion_point(field_get:csce438.UserState.following)
+  return _internal_following(index);
+}
+inline std::string* UserState::mutable_following(int index) {
+  // @@protoc_insertion_point(field_mutable:csce438.UserState.following)
+  return _impl_.following_.Mutable(index);
+}
+inline void UserState::set_following(int index, const std::string& value) {
+  _impl_.following_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:csce438.UserState.following)
+}
+inline void UserState::set_following(int index, std::string&& value) {
+  _impl_.following_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:csce438.UserState.following)
+}
+inline void UserState::set_following(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.following_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:csce438.UserState.following)
+}
+inline void UserState::set_following(int index, const char* value, size_t size) {
+  _impl_.following_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:csce438.UserState.following)
+}
+inline std::string* UserState::_internal_add_following() {
+  return _impl_.following_.Add();
+}
+inline void UserState::add_following(const std::string& value) {
+  _impl_.following_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:csce438.UserState.following)
+}
+inline void UserState::add_following(std::string&& value) {
+  _impl_.following_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:csce438.UserState.following)
+}
+inline void UserState::add_following(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.following_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:csce438.UserState.following)
+}
+inline void UserState::add_following(const char* value, size_t size) {
+  _impl_.following_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:csce438.UserState.following)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+UserState::following() const {
+  // @@protoc_insertion_point(field_list:csce438.UserState.following)
+  return _impl_.following_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+UserState::mutable_following() {
+  // @@protoc_insertion_point(field_mutable_list:csce438.UserState.following)
+  return &_impl_.following_;
+}
+
+// uint64 seq_high = 4;
+inline void UserState::clear_seq_high() {
+  _impl_.seq_high_ = uint64_t{0u};
+}
+inline uint64_t UserState::_internal_seq_high() const {
+  return _impl_.seq_high_;
+}
+inline uint64_t UserState::seq_high() const {
+  // @@protoc_insertion_point(field_get:csce438.UserState.seq_high)
+  return _internal_seq_high();
+}
+inline void UserState::_internal_set_seq_high(uint64_t value) {
+  
+  _impl_.seq_high_ = value;
+}
+inline void UserState::set_seq_high(uint64_t value) {
+  _internal_set_seq_high(value);
+  // @@protoc_insertion_point(field_set:csce438.UserState.seq_high)
+}
+
+// uint64 seq_window = 5;
+inline void UserState::clear_seq_window() {
+  _impl_.seq_window_ = uint64_t{0u};
+}
+inline uint64_t UserState::_internal_seq_window() const {
+  return _impl_.seq_window_;
+}
+inline uint64_t UserState::seq_window() const {
+  // @@protoc_insertion_point(field_get:csce438.UserState.seq_window)
+  return _internal_seq_window();
+}
+inline void UserState::_internal_set_seq_window(uint64_t value) {
+  
+  _impl_.seq_window_ = value;
+}
+inline void UserState::set_seq_window(uint64_t value) {
+  _internal_set_seq_window(value);
+  // @@protoc_insertion_point(field_set:csce438.UserState.seq_window)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace csce438
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_sns_2eproto
@@ -0,0 +1,469 @@
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#include "sns.pb.h"
+
+/*
+ * On-disk timeline format.
+ *
+ * A feed file is a sequence of records, each a 4-byte little-endian length
+ * followed by a serialized Message (sender, text, raw seconds/nanos
+ * timestamp and sequence number). A post is encoded once and the same bytes
+ * are appended to every feed it belongs to; turning the timestamp into text
+ * is left to whoever displays the post.
+ *
+ * Following feeds (the timelines clients page through) also have an index:
+ * an 8-byte little-endian id of the first indexed post, followed by the
+ * 8-byte offset of every record in the feed. A post's id is its position in
+ * the index, so a page of posts before a given id is found without reading
+ * anything but that page.
+ *
+ * Retention (compaction.h) replaces a feed and its index with trimmed copies
+ * while holding an exclusive flock() on the feed. Appenders lock the feed
+ * and readers briefly share the lock while opening the pair, and both open
+ * the feed again if it was replaced while they waited.
+ *
+ * The older posts of a following feed can be moved to its cold tier (also
+ * by compaction.h): blocks of COLD_BLOCK_POSTS consecutive records,
+ * compressed together, appended to USERfollowing.cold, and an entry per
+ * block appended to USERfollowing.cdx:
+ *
+ *     first post id (8), offset in the .cold file (8), newest timestamp
+ *     seconds (8), compressed and raw length (4 each), posts (4), codec (4)
+ *
+ * The feed's index then starts after the last post moved. A page of posts
+ * older than that is read from the one or two blocks holding it, and the
+ * newest posts (timeline replay, the first pages) never touch the tier.
+ */
+
+#define RECORD_HEADER_SIZE 4
+#define INDEX_HEADER_SIZE 8
+#define INDEX_ENTRY_SIZE 8
+#define COLD_BLOCK_POSTS 256
+#define COLD_ENTRY_SIZE 40
+#define COLD_CODEC_ZLIB 1
+
+// Feed holding a user's own posts and the posts they received
+inline std::string userFeedPath(const std::string &username)
+{
+	return username + ".dat";
+}
+
+// Feed holding the posts of the users a user follows (replayed when their timeline opens)
+inline std::string followingFeedPath(const std::string &username)
+{
+	return username + "following.dat";
+}
+
+// Encode a post as a length-prefixed record
+inline std::string encodePost(const csce438::Message &message)
+{
+	std::string record(RECORD_HEADER_SIZE, '\0');
+	message.AppendToString(&record);
+	uint32_t len = record.size() - RECORD_HEADER_SIZE;
+	for (int i = 0; i < RECORD_HEADER_SIZE; i++)
+		record[i] = (char) ((len >> (8 * i)) & 0xff);
+	return record;
+}
+
+// Decode the payload length from a record header
+inline uint32_t recordLength(const char *header)
+{
+	uint32_t len = 0;
+	for (int i = 0; i < RECORD_HEADER_SIZE; i++)
+		len |= (uint32_t) (unsigned char) header[i] << (8 * i);
+	return len;
+}
+
+// Write all of buf to fd, false on error
+inline bool writeAll(int fd, const char *buf, size_t len)
+{
+	while (len > 0)
+	{
+		ssize_t n = write(fd, buf, len);
+		if (n <= 0)
+			return false;
+		buf += n;
+		len -= n;
+	}
+	return true;
+}
+
+// Open a feed and flock() it (LOCK_EX or LOCK_SH), again if it was replaced by a compaction
+// while waiting for the lock (the file we hold then has no name left); -1 on error
+inline int openLockedFeed(const std::string &path, int flags, int lock)
+{
+	while (true)
+	{
+		int fd = open(path.c_str(), flags | O_CLOEXEC, 0644);
+		if (fd < 0)
+			return -1;
+		struct stat st;
+		if (flock(fd, lock) == 0 && fstat(fd, &st) == 0 && st.st_nlink > 0)
+			return fd;
+		close(fd);
+	}
+}
+
+// Append an encoded record to a feed file, creating it if necessary
+inline bool appendRecord(const std::string &path, const std::string &record)
+{
+	int fd = openLockedFeed(path, O_WRONLY | O_CREAT | O_APPEND, LOCK_EX);
+	if (fd < 0)
+		return false;
+	bool ok = writeAll(fd, record.data(), record.size());
+	close(fd);
+	return ok;
+}
+
+// Index of a feed, next to it with the extension .idx
+inline std::string feedIndexPath(const std::string &feed_path)
+{
+	return feed_path.substr(0, feed_path.size() - 4) + ".idx";
+}
+
+// Cold tier of a following feed (blocks and block index), next to it
+inline std::string coldPath(const std::string &feed_path)
+{
+	return feed_path.substr(0, feed_path.size() - 4) + ".cold";
+}
+
+inline std::string coldIndexPath(const std::string &feed_path)
+{
+	return feed_path.substr(0, feed_path.size() - 4) + ".cdx";
+}
+
+inline void encodeU64(char *buf, uint64_t value)
+{
+	for (int i = 0; i < 8; i++)
+		buf[i] = (char) ((value >> (8 * i)) & 0xff);
+}
+
+inline uint64_t decodeU64(const char *buf)
+{
+	uint64_t value = 0;
+	for (int i = 0; i < 8; i++)
+		value |= (uint64_t) (unsigned char) buf[i] << (8 * i);
+	return value;
+}
+
+// A block of the cold tier, as described by its entry in the block index
+struct ColdBlock
+{
+	uint64_t first_id;
+	uint64_t offset;
+	int64_t newest_seconds;
+	uint32_t compressed_len;
+	uint32_t raw_len;
+	uint32_t posts;
+	uint32_t codec;
+};
+
+inline void encodeColdBlock(char *buf, const ColdBlock &block)
+{
+	encodeU64(buf, block.first_id);
+	encodeU64(buf + 8, block.offset);
+	encodeU64(buf + 16, block.newest_seconds);
+	encodeU64(buf + 24, block.compressed_len | (uint64_t) block.raw_len << 32);
+	encodeU64(buf + 32, block.posts | (uint64_t) block.codec << 32);
+}
+
+inline ColdBlock decodeColdBlock(const char *buf)
+{
+	ColdBlock block;
+	block.first_id = decodeU64(buf);
+	block.offset = decodeU64(buf + 8);
+	block.newest_seconds = decodeU64(buf + 16);
+	uint64_t lengths = decodeU64(buf + 24), posts = decodeU64(buf + 32);
+	block.compressed_len = (uint32_t) lengths;
+	block.raw_len = lengths >> 32;
+	block.posts = (uint32_t) posts;
+	block.codec = posts >> 32;
+	return block;
+}
+
+// Compress the records of a cold block (COLD_CODEC_ZLIB) at a zlib level, false on failure
+inline bool compressColdBlock(const char *raw, size_t raw_len, int level, std::string &compressed)
+{
+	uLongf len = compressBound(raw_len);
+	compressed.resize(len);
+	if (compress2((Bytef *) &compressed[0], &len, (const Bytef *) raw, raw_len, level) != Z_OK)
+		return false;
+	compressed.resize(len);
+	return true;
+}
+
+// The entry of a cold block, false if the block index has no such block
+inline bool readColdBlock(int cdx, uint64_t number, ColdBlock &block)
+{
+	char entry[COLD_ENTRY_SIZE];
+	if (pread(cdx, entry, COLD_ENTRY_SIZE, number * COLD_ENTRY_SIZE) != COLD_ENTRY_SIZE)
+		return false;
+	block = decodeColdBlock(entry);
+	return true;
+}
+
+// Read the posts with ids in [start_id, end_id) from the cold tier (of blocks entries), oldest first
+// Only the blocks holding them are read and decompressed
+inline void readColdPosts(int cdx, int cold, uint64_t blocks, uint64_t start_id, uint64_t end_id,
+						  std::vector<csce438::Message> &posts)
+{
+	// The last block starting at or before start_id
+	uint64_t lo = 0, hi = blocks;
+	ColdBlock block;
+	while (hi - lo > 1)
+	{
+		uint64_t mid = lo + (hi - lo) / 2;
+		if (!readColdBlock(cdx, mid, block))
+			return;
+		if (block.first_id <= start_id)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	std::string compressed, raw;
+	for (uint64_t number = lo; number < blocks && readColdBlock(cdx, number, block) && block.first_id < end_id; number++)
+	{
+		if (block.first_id + block.posts <= start_id)
+			continue;
+		compressed.resize(block.compressed_len);
+		raw.resize(block.raw_len);
+		uLongf raw_len = block.raw_len;
+		if (block.codec != COLD_CODEC_ZLIB
+				|| pread(cold, &compressed[0], compressed.size(), block.offset) != (ssize_t) compressed.size()
+				|| uncompress((Bytef *) &raw[0], &raw_len, (const Bytef *) compressed.data(), compressed.size()) != Z_OK)
+			return;
+		size_t pos = 0;
+		for (uint64_t id = block.first_id; id < block.first_id + block.posts && pos + RECORD_HEADER_SIZE <= raw_len; id++)
+		{
+			uint32_t len = recordLength(&raw[pos]);
+			if (pos + RECORD_HEADER_SIZE + len > raw_len)
+				break;
+			csce438::Message post;
+			if (id >= start_id && id < end_id && post.ParseFromArray(&raw[pos + RECORD_HEADER_SIZE], len))
+			{
+				post.set_post_id(id);
+				posts.push_back(post);
+			}
+			pos += RECORD_HEADER_SIZE + len;
+		}
+	}
+}
+
+// Serializes index creation (and compaction swapping feeds in); appends pair a record with its index
+// entry under the feed's flock(), which threads of the process take on descriptors of their own
+inline std::mutex &feedMutex()
+{
+	static std::mutex mtx;
+	return mtx;
+}
+
+// Write an index for a feed by scanning its record headers (in large blocks)
+// Used for feeds written before they were indexed; the caller holds feedMutex()
+inline bool buildIndex(const std::string &path)
+{
+	int fd = open(path.c_str(), O_RDONLY);
+	std::string index(INDEX_HEADER_SIZE, '\0');
+	encodeU64(&index[0], 1);
+	if (fd >= 0)
+	{
+		std::vector<char> block(1 << 16);
+		off_t block_start = 0, pos = 0;
+		ssize_t block_len = 0;
+		char entry[INDEX_ENTRY_SIZE];
+		while (true)
+		{
+			// Refill the block whenever the next header is not entirely inside it
+			if (pos + RECORD_HEADER_SIZE > block_start + block_len)
+			{
+				block_start = pos;
+				block_len = pread(fd, block.data(), block.size(), pos);
+				if (block_len < RECORD_HEADER_SIZE)
+					break;
+			}
+			encodeU64(entry, pos);
+			index.append(entry, INDEX_ENTRY_SIZE);
+			pos += RECORD_HEADER_SIZE + recordLength(&block[pos - block_start]);
+		}
+		close(fd);
+	}
+
+	// Write to the side and rename, so readers never see a partial index
+	std::string index_path = feedIndexPath(path), tmp_path = index_path + ".tmp";
+	{
+		std::ofstream out(tmp_path, std::ios::trunc | std::ios::binary);
+		out.write(index.data(), index.size());
+		if (!out)
+			return false;
+	}
+	return rename(tmp_path.c_str(), index_path.c_str()) == 0;
+}
+
+// Build the index of a feed if it does not have one yet; the caller holds feedMutex()
+inline bool ensureIndex(const std::string &path)
+{
+	if (access(feedIndexPath(path).c_str(), F_OK) == 0)
+		return true;
+	return buildIndex(path);
+}
+
+// Append an encoded record to an indexed feed, creating both files if necessary
+// Returns the id the post was given in this feed, 0 on failure
+inline uint64_t appendIndexedRecord(const std::string &path, const std::string &record)
+{
+	{
+		std::lock_guard<std::mutex> lock(feedMutex());
+		if (!ensureIndex(path))
+			return 0;
+	}
+
+	// Other threads, and another process while a hot restart overlaps us, append to the same feeds:
+	// the record and its index entry go in together (the lock goes with the descriptor, opened for this append)
+	int fd = openLockedFeed(path, O_WRONLY | O_CREAT | O_APPEND, LOCK_EX);
+	if (fd < 0)
+		return 0;
+	off_t offset = lseek(fd, 0, SEEK_END);
+	if (offset < 0)
+	{
+		close(fd);
+		return 0;
+	}
+
+	// A record left without its index entry (or cut short) would shift every later post's offset, take it back
+	int idx = open(feedIndexPath(path).c_str(), O_RDWR | O_APPEND);
+	char header[INDEX_HEADER_SIZE], entry[INDEX_ENTRY_SIZE];
+	struct stat st;
+	if (idx < 0 || pread(idx, header, INDEX_HEADER_SIZE, 0) != INDEX_HEADER_SIZE || fstat(idx, &st) < 0
+			|| !writeAll(fd, record.data(), record.size()))
+	{
+		ftruncate(fd, offset);
+		if (idx >= 0)
+			close(idx);
+		close(fd);
+		return 0;
+	}
+	uint64_t post_id = decodeU64(header) + (st.st_size - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE;
+	encodeU64(entry, offset);
+	bool ok = writeAll(idx, entry, INDEX_ENTRY_SIZE);
+	if (!ok)
+	{
+		ftruncate(idx, st.st_size);
+		ftruncate(fd, offset);
+	}
+	close(idx);
+	close(fd);
+	return ok ? post_id : 0;
+}
+
+// Read a page of (up to) limit posts with ids below before_post_id (0 for the newest posts), oldest first
+// Each post gets its id set, and next_before_post_id is the cursor for the next older page (0 if there is none)
+// Only the index entries of the page and the records they point to are read
+// Returns false if the feed does not exist
+inline bool readTimelinePage(const std::string &path, uint64_t before_post_id, size_t limit,
+							 std::vector<csce438::Message> &posts, uint64_t &next_before_post_id)
+{
+	next_before_post_id = 0;
+	if (access(path.c_str(), F_OK) != 0)
+		return false;
+	{
+		std::lock_guard<std::mutex> lock(feedMutex());
+		if (!ensureIndex(path))
+			return false;
+	}
+
+	// The index and the cold tier are opened while the feed is locked, so all belong to the same
+	// version of the feed (the tier may not exist)
+	int fd = openLockedFeed(path, O_RDONLY, LOCK_SH);
+	int idx = fd >= 0 ? open(feedIndexPath(path).c_str(), O_RDONLY | O_CLOEXEC) : -1;
+	int cdx = fd >= 0 ? open(coldIndexPath(path).c_str(), O_RDONLY | O_CLOEXEC) : -1;
+	int cold = fd >= 0 ? open(coldPath(path).c_str(), O_RDONLY | O_CLOEXEC) : -1;
+	if (fd >= 0)
+		flock(fd, LOCK_UN);
+	struct stat cdx_st;
+	uint64_t blocks = 0;
+	ColdBlock oldest;
+	if (cdx >= 0 && cold >= 0 && fstat(cdx, &cdx_st) == 0)
+		blocks = cdx_st.st_size / COLD_ENTRY_SIZE;
+	if (blocks > 0 && !readColdBlock(cdx, 0, oldest))
+		blocks = 0;
+
+	struct stat idx_st, feed_st;
+	char header[INDEX_HEADER_SIZE];
+	if (idx < 0 || fd < 0 || fstat(idx, &idx_st) < 0 || fstat(fd, &feed_st) < 0
+			|| pread(idx, header, INDEX_HEADER_SIZE, 0) != INDEX_HEADER_SIZE)
+	{
+		if (idx >= 0) close(idx);
+		if (fd >= 0) close(fd);
+		if (cdx >= 0) close(cdx);
+		if (cold >= 0) close(cold);
+		return true;
+	}
+
+	// Post ids base_id..end_id-1 are in the index, the older ones from first_id on in the cold tier
+	uint64_t base_id = decodeU64(header);
+	uint64_t entries = (idx_st.st_size - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE;
+	uint64_t first_id = (blocks > 0 && oldest.first_id < base_id) ? oldest.first_id : base_id;
+	uint64_t end_id = base_id + entries;
+	if (before_post_id != 0 && before_post_id < end_id)
+		end_id = before_post_id;
+	uint64_t start_id = (end_id > first_id + limit) ? end_id - limit : first_id;
+
+	if (start_id < base_id && end_id > start_id)
+		readColdPosts(cdx, cold, blocks, start_id, std::min(end_id, base_id), posts);
+	if (end_id > std::max(start_id, base_id))
+	{
+		// Offsets of the page, plus the offset following it (the end of the page's last record)
+		uint64_t hot_start_id = std::max(start_id, base_id);
+		uint64_t count = end_id - hot_start_id;
+		bool has_next_entry = end_id < base_id + entries;
+		std::vector<char> entry_buf((count + has_next_entry) * INDEX_ENTRY_SIZE);
+		off_t entry_pos = INDEX_HEADER_SIZE + (hot_start_id - base_id) * INDEX_ENTRY_SIZE;
+		if (pread(idx, entry_buf.data(), entry_buf.size(), entry_pos) == (ssize_t) entry_buf.size())
+		{
+			off_t first = decodeU64(&entry_buf[0]);
+			off_t last = has_next_entry ? (off_t) decodeU64(&entry_buf[count * INDEX_ENTRY_SIZE]) : feed_st.st_size;
+
+			// The page's records are contiguous, read them all at once
+			std::string records(last - first, '\0');
+			if (last > first && pread(fd, &records[0], records.size(), first) == (ssize_t) records.size())
+			{
+				size_t pos = 0;
+				for (uint64_t id = hot_start_id; id < end_id && pos + RECORD_HEADER_SIZE <= records.size(); id++)
+				{
+					uint32_t len = recordLength(&records[pos]);
+					if (pos + RECORD_HEADER_SIZE + len > records.size())
+						break;
+					csce438::Message post;
+					if (post.ParseFromArray(&records[pos + RECORD_HEADER_SIZE], len))
+					{
+						post.set_post_id(id);
+						posts.push_back(post);
+					}
+					pos += RECORD_HEADER_SIZE + len;
+				}
+			}
+		}
+	}
+	if (start_id > first_id && end_id > start_id)
+		next_before_post_id = start_id;
+	close(idx);
+	close(fd);
+	if (cdx >= 0) close(cdx);
+	if (cold >= 0) close(cold);
+	return true;
+}
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef SUPERVISOR_H
+#define SUPERVISOR_H
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ratelimit.h"
+
+/*
+ * Supervision of the peer process (the slave supervises its master or
+ * router, the master supervises its slave).
+ *
+ * The supervisor tracks exactly one process through a pidfd: either one it
+ * adopted (the peer that announced its pid in its heartbeats, when both were
+ * started from outside) or one it spawned itself. Restarting kills that
+ * process only, spawns a replacement with posix_spawn and waits for it to
+ * report ready on a pipe handed to it as fd READY_FD (named by the
+ * TSNS_READY_FD environment variable) instead of sleeping for a fixed time.
+ * A replacement that exits or does not report ready in time is retried with
+ * exponential backoff, as is a process that keeps dying soon after starting.
+ * Waiting on the pidfd between heartbeats also notices an exit immediately.
+ */
+
+// Descriptor a spawned process reports readiness on
+#define READY_FD 3
+
+// How long a spawned process has to report ready
+#define READY_TIMEOUT_MS 10000
+
+// Restart backoff: first delay, cap, and how long a process must have run to reset it
+#define BACKOFF_MIN_MS 100
+#define BACKOFF_MAX_MS 5000
+#define BACKOFF_RESET_MS 2000
+
+// Spawn attempts per restart before giving up
+#define MAX_SPAWN_ATTEMPTS 8
+
+// Tell the supervisor that spawned this process (if any) that it is ready
+inline void notifyReady()
+{
+	const char *fd = getenv("TSNS_READY_FD");
+	if (fd == NULL)
+		return;
+	int ready_fd = atoi(fd);
+	char byte = 1;
+	if (write(ready_fd, &byte, 1) < 0) {}
+	close(ready_fd);
+	unsetenv("TSNS_READY_FD");
+}
+
+// Pid a peer announces in its heartbeat ("ALIVE <pid>"), 0 if none
+inline pid_t heartbeatPid(const char *buf, int len)
+{
+	std::string msg(buf, len);
+	size_t space = msg.find(' ');
+	if (space == std::string::npos)
+		return 0;
+	return atoi(msg.c_str() + space + 1);
+}
+
+class Supervisor
+{
+	public:
+		explicit Supervisor(const std::vector<std::string> &args) : args(args) {}
+
+		~Supervisor()
+		{
+			if (pidfd >= 0)
+				close(pidfd);
+		}
+
+		// Track a process this one did not spawn (e.g. the peer that announced itself in its heartbeat)
+		void adopt(pid_t adopted)
+		{
+			// A child handing over to a process of its own (hot restart) still has to be reaped once it exits
+			if (spawned && pid > 0)
+			{
+				pid_t previous = pid;
+				std::thread([previous]() { waitpid(previous, NULL, 0); }).detach();
+			}
+			release();
+			if (adopted <= 0)
+				return;
+			pid = adopted;
+			spawned = false;
+			pidfd = openPidfd(pid);
+			started_ns = monotonicNanos();
+		}
+
+		// Kill the tracked process (if it is still running) and wait for it to be gone
+		void stop()
+		{
+			if (pid <= 0)
+				return;
+			// Through the pidfd, so a recycled pid is never signalled
+			#ifdef SYS_pidfd_send_signal
+				if (pidfd >= 0)
+					syscall(SYS_pidfd_send_signal, pidfd, SIGKILL, NULL, 0);
+				else
+			#endif
+					kill(pid, SIGKILL);
+			if (spawned)
+				waitpid(pid, NULL, 0);
+			else if (pidfd >= 0)
+			{
+				// Not our child, the pidfd becomes readable once it has exited
+				struct pollfd exited = {pidfd, POLLIN, 0};
+				poll(&exited, 1, 1000);
+			}
+			release();
+		}
+
+		// Replace the tracked process with a freshly spawned one that has reported ready
+		// Returns false if no replacement became ready within MAX_SPAWN_ATTEMPTS attempts
+		bool restart()
+		{
+			int64_t now = monotonicNanos();
+			if (pid > 0 && now - started_ns < BACKOFF_RESET_MS * 1000000LL)
+				backoff_ms = std::min(BACKOFF_MAX_MS, std::max(BACKOFF_MIN_MS, backoff_ms * 2));
+			else
+				backoff_ms = 0;
+			stop();
+
+			for (int attempt = 0; attempt < MAX_SPAWN_ATTEMPTS; attempt++)
+			{
+				if (backoff_ms > 0)
+					std::this_thread::sleep_for(std::chrono::milliseconds(backoff_ms));
+				if (spawnReady())
+					return true;
+				stop();
+				backoff_ms = std::min(BACKOFF_MAX_MS, std::max(BACKOFF_MIN_MS, backoff_ms * 2));
+			}
+			return false;
+		}
+
+		// Wait up to timeout_ms for the tracked process to exit (through its pidfd), returns true if it has
+		bool waitForExit(int timeout_ms)
+		{
+			if (pidfd < 0)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+				return false;
+			}
+			struct pollfd exited = {pidfd, POLLIN, 0};
+			return poll(&exited, 1, timeout_ms) == 1;
+		}
+
+		pid_t current() const { return pid; }
+
+	private:
+		static int openPidfd(pid_t p)
+		{
+			#ifdef SYS_pidfd_open
+				return syscall(SYS_pidfd_open, p, 0);
+			#else
+				return -1;
+			#endif
+		}
+
+		void release()
+		{
+			if (pidfd >= 0)
+				close(pidfd);
+			pidfd = -1;
+			pid = 0;
+		}
+
+		// Spawn the process and wait until it reports ready, exits, or times out
+		bool spawnReady()
+		{
+			int ready[2];
+			if (pipe2(ready, O_CLOEXEC) < 0)
+				return false;
+
+			// The child gets the write end as READY_FD and no other descriptor of ours (listening sockets included)
+			posix_spawn_file_actions_t actions;
+			posix_spawn_file_actions_init(&actions);
+			posix_spawn_file_actions_adddup2(&actions, ready[1], READY_FD);
+			#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34))
+				posix_spawn_file_actions_addclosefrom_np(&actions, READY_FD + 1);
+			#endif
+
+			std::vector<std::string> env_strings;
+			for (char **e = environ; *e != NULL; e++)
+				if (strncmp(*e, "TSNS_READY_FD=", 14) != 0)
+					env_strings.push_back(*e);
+			env_strings.push_back("TSNS_READY_FD=" + std::to_string(READY_FD));
+			std::vector<char *> argv, envp;
+			for (const std::string &arg : args)
+				argv.push_back((char *) arg.c_str());
+			argv.push_back(NULL);
+			for (const std::string &e : env_strings)
+				envp.push_back((char *) e.c_str());
+			envp.push_back(NULL);
+
+			pid_t child;
+			int err = posix_spawnp(&child, argv[0], &actions, NULL, argv.data(), envp.data());
+			posix_spawn_file_actions_destroy(&actions);
+			close(ready[1]);
+			if (err != 0)
+			{
+				close(ready[0]);
+				return false;
+			}
+			pid = child;
+			spawned = true;
+			pidfd = openPidfd(child);
+			started_ns = monotonicNanos();
+
+			// A byte means ready, end of file means the child exited (or closed the pipe) first
+			struct pollfd waiting = {ready[0], POLLIN, 0};
+			char byte;
+			bool is_ready = poll(&waiting, 1, READY_TIMEOUT_MS) == 1 && read(ready[0], &byte, 1) == 1;
+			close(ready[0]);
+			return is_ready;
+		}
+
+		const std::vector<std::string> args;
+		pid_t pid = 0;
+		int pidfd = -1;
+		bool spawned = false;
+		int64_t started_ns = 0;
+		int backoff_ms = 0;
+};
+
+#endif
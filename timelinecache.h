@@ -0,0 +1,170 @@
+#ifndef TIMELINECACHE_H
+#define TIMELINECACHE_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "sns.pb.h"
+
+/*
+ * tsc's cache of the newest posts of a user's timeline, so entering TIMELINE
+ * shows them straight away instead of after the master's replay.
+ *
+ * One file per user and master (post ids are numbered in each master's
+ * feeds), mapped into memory: a header and a ring of fixed size slots, one
+ * post each, written as posts arrive. The newest cached post id is sent when
+ * the stream is opened, and the master only replays the posts after it.
+ *
+ *     header   magic, version, slots, count, head (next slot), newest post id
+ *     slot     post id, timestamp seconds, username and message lengths, then
+ *              the username and message (cut to fit)
+ */
+
+// As many posts as a master replays when a stream is opened
+#define CACHE_POSTS 20
+#define CACHE_SLOT_SIZE 512
+#define CACHE_MAGIC 0x4548434143435354ULL	// "TSCCACHE"
+#define CACHE_VERSION 1
+
+// Cache file of a user's timeline on the master at "ip:port"
+inline std::string timelineCachePath(const std::string &username, const std::string &master)
+{
+    return "tsc-" + username + "-" + master + ".cache";
+}
+
+class TimelineCache
+{
+    public:
+        ~TimelineCache() { close(); }
+
+        // Map the cache file, starting it over if it is new or not a cache of this layout
+        // Without it (e.g. in a read-only directory) nothing is cached
+        bool open(const std::string &path)
+        {
+            close();
+            size_t size = sizeof(Header) + CACHE_POSTS * sizeof(Slot);
+            struct stat st;
+            if ((fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600)) < 0
+                    || fstat(fd, &st) < 0
+                    || ((size_t) st.st_size != size && ftruncate(fd, size) < 0))
+            {
+                close();
+                return false;
+            }
+            void *mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapped == MAP_FAILED)
+            {
+                close();
+                return false;
+            }
+            header = (Header *) mapped;
+            slots = (Slot *) (header + 1);
+            if (header->magic != CACHE_MAGIC || header->version != CACHE_VERSION || header->slots != CACHE_POSTS
+                    || header->count > CACHE_POSTS || header->head >= CACHE_POSTS)
+            {
+                memset(mapped, 0, size);
+                header->magic = CACHE_MAGIC;
+                header->version = CACHE_VERSION;
+                header->slots = CACHE_POSTS;
+            }
+            return true;
+        }
+
+        void close()
+        {
+            if (header != NULL)
+                munmap(header, sizeof(Header) + CACHE_POSTS * sizeof(Slot));
+            if (fd >= 0)
+                ::close(fd);
+            header = NULL;
+            slots = NULL;
+            fd = -1;
+        }
+
+        // Newest cached post id, 0 if there is none
+        uint64_t newest() const { return header != NULL ? header->newest_post_id : 0; }
+
+        // The cached posts, oldest first
+        std::vector<csce438::Message> posts() const
+        {
+            std::vector<csce438::Message> cached;
+            if (header == NULL)
+                return cached;
+            for (uint32_t i = 0; i < header->count; i++)
+            {
+                const Slot &slot = slots[(header->head + CACHE_POSTS - header->count + i) % CACHE_POSTS];
+                if (slot.username_len + slot.msg_len > sizeof(slot.data))
+                    continue;
+                csce438::Message m;
+                m.set_post_id(slot.post_id);
+                m.mutable_timestamp()->set_seconds(slot.seconds);
+                m.set_username(std::string(slot.data, slot.username_len));
+                m.set_msg(std::string(slot.data + slot.username_len, slot.msg_len));
+                cached.push_back(m);
+            }
+            return cached;
+        }
+
+        // Drop every cached post (the master's feed was started over)
+        void clear()
+        {
+            if (header == NULL)
+                return;
+            memset(slots, 0, CACHE_POSTS * sizeof(Slot));
+            header->count = 0;
+            header->head = 0;
+            header->newest_post_id = 0;
+        }
+
+        // Cache a post newer than the ones cached, over the oldest one once full
+        // (the slot is filled in before the header points at it)
+        void add(const csce438::Message &m)
+        {
+            if (header == NULL || m.post_id() <= header->newest_post_id)
+                return;
+            Slot &slot = slots[header->head];
+            slot.post_id = m.post_id();
+            slot.seconds = m.timestamp().seconds();
+            slot.username_len = std::min<size_t>(m.username().size(), sizeof(slot.data));
+            slot.msg_len = std::min<size_t>(m.msg().size(), sizeof(slot.data) - slot.username_len);
+            memcpy(slot.data, m.username().data(), slot.username_len);
+            memcpy(slot.data + slot.username_len, m.msg().data(), slot.msg_len);
+            header->head = (header->head + 1) % CACHE_POSTS;
+            if (header->count < CACHE_POSTS)
+                header->count++;
+            header->newest_post_id = m.post_id();
+        }
+
+    private:
+        struct Header
+        {
+            uint64_t magic;
+            uint32_t version;
+            uint32_t slots;
+            uint32_t count;
+            uint32_t head;
+            uint64_t newest_post_id;
+        };
+
+        struct Slot
+        {
+            uint64_t post_id;
+            int64_t seconds;
+            uint16_t username_len;
+            uint16_t msg_len;
+            char data[CACHE_SLOT_SIZE - 20];
+        };
+
+        int fd = -1;
+        Header *header = NULL;
+        Slot *slots = NULL;
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*
+ * Hashed timer wheel for periodic work driven from an event loop.
+ *
+ * Timers are hashed into a ring of slots by the tick they expire in, so
+ * scheduling is O(1) and advancing only visits the slots of the ticks that
+ * have passed. Timers more than a full turn ahead stay in their slot until
+ * the wheel comes round to their turn.
+ */
+
+class TimerWheel
+{
+	public:
+		TimerWheel(int64_t tick_ns, size_t num_slots, int64_t now_ns)
+			: tick_ns(tick_ns), slots(num_slots), current_tick(now_ns / tick_ns) {}
+
+		// Fire the timer with the given id at (the first tick boundary after) when_ns
+		void schedule(uint64_t id, int64_t when_ns)
+		{
+			int64_t tick = when_ns / tick_ns;
+			if (tick <= current_tick)
+				tick = current_tick + 1;
+			slots[tick % slots.size()].push_back(std::make_pair(tick, id));
+		}
+
+		// Append the ids of every timer that expired up to now_ns to due
+		void advance(int64_t now_ns, std::vector<uint64_t> &due)
+		{
+			int64_t now_tick = now_ns / tick_ns;
+			// After a long stall a single pass over every slot is enough
+			int64_t first_tick = current_tick + 1;
+			if (now_tick - first_tick >= (int64_t) slots.size())
+				first_tick = now_tick - slots.size() + 1;
+			for (int64_t tick = first_tick; tick <= now_tick; tick++)
+			{
+				std::vector<std::pair<int64_t, uint64_t>> &slot = slots[tick % slots.size()];
+				for (size_t i = 0; i < slot.size();)
+				{
+					if (slot[i].first <= now_tick)
+					{
+						due.push_back(slot[i].second);
+						slot[i] = slot.back();
+						slot.pop_back();
+					}
+					else
+						i++;
+				}
+			}
+			if (now_tick > current_tick)
+				current_tick = now_tick;
+		}
+
+		// Time until the next tick boundary
+		int64_t untilNextTick(int64_t now_ns) const
+		{
+			return (now_ns / tick_ns + 1) * tick_ns - now_ns;
+		}
+
+	private:
+		const int64_t tick_ns;
+		std::vector<std::vector<std::pair<int64_t, uint64_t>>> slots;
+		int64_t current_tick;
+};
+
+#endif
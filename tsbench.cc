@@ -0,0 +1,590 @@
+/*
+ * tsbench - end-to-end load generator for Tiny SNS
+ *
+ * Spawns a local router, master and their slaves (or uses an existing router),
+ * logs in N virtual clients, builds a follower graph between them and drives
+ * a mix of posts, LIST, FOLLOW/UNFOLLOW and LOGIN requests at a target rate.
+ * Reports throughput, the latency of every request type and the
+ * post-to-delivery latency seen by followers' timeline streams.
+ */
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <arpa/inet.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cmath>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpc++/grpc++.h>
+
+#include "histogram.h"
+#include "sns.grpc.pb.h"
+
+using csce438::ListReply;
+using csce438::Message;
+using csce438::Reply;
+using csce438::Request;
+using csce438::SNSService;
+using grpc::Channel;
+using grpc::ChannelArguments;
+using grpc::ClientContext;
+using grpc::ClientReaderWriter;
+using grpc::Status;
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+struct BenchConfig
+{
+	int clients = 100;
+	int follows = 10;
+	string graph = "power";
+	double zipf_exponent = 1.0;
+	double rate = 1000;
+	int duration = 10;
+	int drivers = 4;
+	int channels = 4;
+	double list_fraction = 0.05;
+	double follow_fraction = 0.02;
+	double login_fraction = 0.01;
+	string router_addr = "";
+	string router_port = "3010";
+	double gate_p99_ms = 0;
+	bool verbose = false;
+};
+
+struct VirtualUser
+{
+	string name;
+	SNSService::Stub *stub;
+	unique_ptr<ClientContext> context;
+	unique_ptr<ClientReaderWriter<Message, Message>> stream;
+	thread reader;
+	LatencyHistogram delivery;
+	uint64_t delivered = 0;
+	uint64_t acked = 0;
+	uint64_t rejected = 0;
+	uint64_t next_seq = 1;
+	// The user's follows from the setup graph, unfollowed and followed again by the timed mix
+	vector<int> following;
+	vector<bool> unfollowed;
+};
+
+// Process group holding every server process spawned by the benchmark
+pid_t server_group = 0;
+
+// Exit the process with a message in the event of a fatal error, taking any spawned servers down with it
+void killSession(string error)
+{
+	cerr << "\nBENCH ERROR: " << error << endl;
+	cerr << "errno: " << errno << endl;
+	cerr << "Benchmark shutting down..." << endl;
+	if (server_group != 0)
+		killpg(server_group, SIGKILL);
+	exit(EXIT_FAILURE);
+}
+
+// Current wall clock time in nanoseconds, comparable across processes on this host
+int64_t wallNanos()
+{
+	return chrono::duration_cast<chrono::nanoseconds>(chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Start a server process in the benchmark's server process group
+pid_t spawn(const vector<string> &args, bool verbose)
+{
+	pid_t pid = fork();
+	if (pid < 0)
+		killSession("fork() failed in spawn()");
+	if (pid == 0)
+	{
+		setpgid(0, server_group);
+		if (!verbose)
+		{
+			int null_fd = open("/dev/null", O_WRONLY);
+			dup2(null_fd, STDOUT_FILENO);
+			dup2(null_fd, STDERR_FILENO);
+		}
+		vector<char *> argv;
+		for (const string &arg : args)
+			argv.push_back((char *) arg.c_str());
+		argv.push_back(NULL);
+		execvp(argv[0], argv.data());
+		_exit(127);
+	}
+	setpgid(pid, server_group);
+	if (server_group == 0)
+		server_group = pid;
+	return pid;
+}
+
+// Ask the router for the available master, returns "" if there is none (or the router is unreachable)
+string askRouter(const string &router_addr, const string &router_port)
+{
+	int sock;
+	struct sockaddr_in addr;
+	char buf[1024];
+
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(stoi(router_port));
+	if (inet_pton(AF_INET, router_addr.c_str(), &addr.sin_addr) <= 0)
+		killSession("Invalid router address in askRouter()");
+
+	if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+		killSession("Socket error in askRouter()");
+
+	int status = -1;
+	if (connect(sock, (struct sockaddr *) &addr, sizeof(addr)) == 0)
+		status = read(sock, buf, sizeof(buf));
+	close(sock);
+
+	// A single byte means no master is available
+	if (status <= 1)
+		return "";
+	string master(buf, strnlen(buf, status));
+	if (master.find(':') == string::npos)
+		master += ":" + router_port;
+	return master;
+}
+
+// Milliseconds a server that turned a call away (RESOURCE_EXHAUSTED) asked to wait before retrying it
+int retryAfterMs(const ClientContext &context)
+{
+	multimap<grpc::string_ref, grpc::string_ref>::const_iterator hint = context.GetServerTrailingMetadata().find("retry-after-ms");
+	if (hint == context.GetServerTrailingMetadata().end())
+		return 100;
+	return max(1, atoi(string(hint->second.data(), hint->second.size()).c_str()));
+}
+
+// Pick who every user follows, either uniformly or with Zipf-distributed popularity
+// (user 0 is the most popular), giving a power-law follower count distribution
+vector<vector<int>> buildGraph(const BenchConfig &config, mt19937_64 &rng)
+{
+	int n = config.clients;
+	vector<double> cdf(n);
+	double total = 0;
+	for (int i = 0; i < n; i++)
+	{
+		total += (config.graph == "power") ? 1.0 / pow(i + 1, config.zipf_exponent) : 1.0;
+		cdf[i] = total;
+	}
+
+	uniform_real_distribution<double> uniform(0, total);
+	vector<vector<int>> following(n);
+	int follows = min(config.follows, n - 1);
+	for (int u = 0; u < n; u++)
+	{
+		// Rejection sampling, bounded so heavily skewed graphs still terminate
+		for (int attempts = 0; (int) following[u].size() < follows && attempts < follows * 50; attempts++)
+		{
+			int target = lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+			if (target >= n || target == u || find(following[u].begin(), following[u].end(), target) != following[u].end())
+				continue;
+			following[u].push_back(target);
+		}
+	}
+	return following;
+}
+
+// Make a timestamped, sequenced post
+Message makePost(VirtualUser &user)
+{
+	Message m;
+	m.set_username(user.name);
+	m.set_msg("tsbench post");
+	m.set_seq(user.next_seq++);
+	int64_t now = wallNanos();
+	m.mutable_timestamp()->set_seconds(now / 1000000000);
+	m.mutable_timestamp()->set_nanos(now % 1000000000);
+	return m;
+}
+
+void usage()
+{
+	cerr << "usage: tsbench [-n clients] [-k follows per client] [-g power|uniform] [-e zipf exponent]\n"
+		 << "               [-r ops/s] [-d seconds] [-t driver threads] [-c channels] [-l list fraction]\n"
+		 << "               [-F follow/unfollow fraction] [-L login fraction]\n"
+		 << "               [-a router address] [-p router port] [-G max p99 ms] [-v]\n";
+}
+
+int main(int argc, char **argv)
+{
+	BenchConfig config;
+
+	int opt = 0;
+	while ((opt = getopt(argc, argv, "n:k:g:e:r:d:t:c:l:F:L:a:p:G:v")) != -1)
+	{
+		switch (opt)
+		{
+		case 'n':
+			config.clients = max(2, atoi(optarg));
+			break;
+		case 'k':
+			config.follows = max(0, atoi(optarg));
+			break;
+		case 'g':
+			config.graph = optarg;
+			break;
+		case 'e':
+			config.zipf_exponent = atof(optarg);
+			break;
+		case 'r':
+			config.rate = atof(optarg);
+			break;
+		case 'd':
+			config.duration = max(1, atoi(optarg));
+			break;
+		case 't':
+			config.drivers = max(1, atoi(optarg));
+			break;
+		case 'c':
+			config.channels = max(1, atoi(optarg));
+			break;
+		case 'l':
+			config.list_fraction = atof(optarg);
+			break;
+		case 'F':
+			config.follow_fraction = atof(optarg);
+			break;
+		case 'L':
+			config.login_fraction = atof(optarg);
+			break;
+		case 'a':
+			config.router_addr = optarg;
+			break;
+		case 'p':
+			config.router_port = optarg;
+			break;
+		case 'G':
+			config.gate_p99_ms = atof(optarg);
+			break;
+		case 'v':
+			config.verbose = true;
+			break;
+		default:
+			usage();
+			return -1;
+		}
+	}
+	if (config.graph != "power" && config.graph != "uniform")
+	{
+		usage();
+		return -1;
+	}
+
+	// Start a local router and master (each with its slave) unless pointed at an existing router
+	// The master reaches the router through a second loopback address since "127.0.0.1" selects router mode
+	if (config.router_addr == "")
+	{
+		config.router_addr = "127.0.0.1";
+		string rport = config.router_port;
+		string mport = to_string(stoi(rport) + 1);
+		cout << "Starting local router (port " << rport << ") and master (port " << mport << ")..." << endl;
+		spawn({"./tsdm", "-a", "127.0.0.1", "-c", rport, "-b", "3059", "-h", "3076"}, config.verbose);
+		spawn({"./tsds", "-a", "127.0.0.1", "-c", rport, "-b", "3059", "-h", "3076"}, config.verbose);
+		sleep(1);
+		spawn({"./tsdm", "-a", "127.0.0.2", "-c", mport, "-b", "3059", "-h", "3077"}, config.verbose);
+		sleep(1);
+		spawn({"./tsds", "-a", "127.0.0.2", "-c", mport, "-b", "3059", "-h", "3077"}, config.verbose);
+	}
+
+	// Wait for a master to register with the router
+	string master = "";
+	for (int i = 0; i < 100 && master == ""; i++)
+	{
+		master = askRouter(config.router_addr, config.router_port);
+		if (master == "")
+			this_thread::sleep_for(chrono::milliseconds(100));
+	}
+	if (master == "")
+		killSession("No master registered with the router");
+	cout << "Router directed benchmark to master " << master << endl;
+
+	// Spread the virtual users over a few separate connections
+	vector<unique_ptr<SNSService::Stub>> stubs;
+	for (int i = 0; i < config.channels; i++)
+	{
+		ChannelArguments args;
+		args.SetInt("tsbench.channel", i);
+		stubs.push_back(SNSService::NewStub(grpc::CreateCustomChannel(master, grpc::InsecureChannelCredentials(), args)));
+	}
+
+	mt19937_64 rng(getpid());
+	vector<VirtualUser> users(config.clients);
+	string prefix = "bench" + to_string(getpid()) + "_";
+	for (int i = 0; i < config.clients; i++)
+	{
+		users[i].name = prefix + to_string(i);
+		users[i].stub = stubs[i % config.channels].get();
+	}
+
+	// Login (retrying while the master finishes starting), done serially since setup is not what is measured
+	for (VirtualUser &user : users)
+	{
+		Request request;
+		request.set_username(user.name);
+		Status status;
+		for (int attempt = 0; attempt < 50; attempt++)
+		{
+			Reply reply;
+			ClientContext context;
+			context.set_deadline(chrono::system_clock::now() + chrono::seconds(2));
+			status = user.stub->Login(&context, request, &reply);
+			if (status.ok())
+				break;
+			this_thread::sleep_for(chrono::milliseconds(100));
+		}
+		if (!status.ok())
+			killSession("Login failed: " + status.error_message());
+	}
+
+	// Build the follower graph, one follow of every user at a time so the master's per-user
+	// follow rate limit refills meanwhile (waiting as asked when it turns a follow away)
+	vector<vector<int>> following = buildGraph(config, rng);
+	uint64_t edges = 0;
+	for (size_t round = 0; round < (size_t) config.follows; round++)
+	{
+		for (int u = 0; u < config.clients; u++)
+		{
+			if (round >= following[u].size())
+				continue;
+			Request request;
+			request.set_username(users[u].name);
+			request.add_arguments(users[following[u][round]].name);
+			Status status;
+			for (int attempt = 0; attempt < 50; attempt++)
+			{
+				Reply reply;
+				ClientContext context;
+				context.set_deadline(chrono::system_clock::now() + chrono::seconds(2));
+				status = users[u].stub->Follow(&context, request, &reply);
+				if (status.error_code() != grpc::StatusCode::RESOURCE_EXHAUSTED)
+					break;
+				this_thread::sleep_for(chrono::milliseconds(retryAfterMs(context)));
+			}
+			if (!status.ok())
+				killSession("Follow failed: " + status.error_message());
+			edges++;
+		}
+	}
+	for (int u = 0; u < config.clients; u++)
+	{
+		users[u].following = following[u];
+		users[u].unfollowed.assign(following[u].size(), false);
+	}
+	cout << "Logged in " << config.clients << " clients with " << edges << " follow edges (" << config.graph << " graph)" << endl;
+
+	// Open every timeline stream, each with a reader measuring delivery latency
+	int64_t bench_start = wallNanos();
+	for (VirtualUser &user : users)
+	{
+		user.context.reset(new ClientContext());
+		user.stream = user.stub->Timeline(user.context.get());
+		Message open;
+		open.set_username(user.name);
+		open.set_open_stream(true);
+		if (!user.stream->Write(open))
+			killSession("Could not open timeline stream for " + user.name);
+
+		VirtualUser *u = &user;
+		user.reader = thread([u, bench_start]() {
+			Message m;
+			while (u->stream->Read(&m))
+			{
+				if (m.ack() != 0)
+				{
+					u->acked++;
+					continue;
+				}
+				// Posts the server turned away (rate limited or overloaded, or too old to deduplicate) are not retried
+				if (m.retry_after_ms() != 0 || m.resync_seq() != 0)
+				{
+					u->rejected++;
+					continue;
+				}
+				// Only count benchmark posts, which are all sequenced
+				int64_t sent = m.timestamp().seconds() * 1000000000 + m.timestamp().nanos();
+				if (m.seq() == 0 || sent < bench_start)
+					continue;
+				u->delivery.record(max<int64_t>(0, wallNanos() - sent));
+				u->delivered++;
+			}
+		});
+	}
+
+	// Drive the load open-loop: every driver owns an interleaved share of the users
+	// (so each stream has a single writer) and issues operations on a fixed schedule
+	// FOLLOW/UNFOLLOW toggles one of the user's setup follows, so the graph never grows past the setup one
+	atomic<uint64_t> posts_sent(0), lists_done(0), follows_done(0), logins_done(0), throttled(0), errors(0);
+	vector<LatencyHistogram> list_latency(config.drivers), follow_latency(config.drivers), login_latency(config.drivers);
+	vector<thread> drivers;
+	Clock::time_point load_start = Clock::now();
+	Clock::time_point load_end = load_start + chrono::seconds(config.duration);
+	for (int d = 0; d < config.drivers; d++)
+	{
+		drivers.push_back(thread([&, d]() {
+			mt19937_64 local_rng(rng() + d);
+			uniform_real_distribution<double> coin(0, 1);
+			vector<VirtualUser *> mine;
+			for (int i = d; i < config.clients; i += config.drivers)
+				mine.push_back(&users[i]);
+			if (mine.empty())
+				return;
+
+			// Issue a unary call with a deadline, recording its latency if it succeeds
+			// (one the master turns away is throttled rather than an error, and not retried)
+			auto timed = [&](LatencyHistogram &latency, atomic<uint64_t> &done, function<Status(ClientContext *)> call) {
+				ClientContext context;
+				context.set_deadline(chrono::system_clock::now() + chrono::seconds(2));
+				Clock::time_point begin = Clock::now();
+				Status status = call(&context);
+				if (status.ok())
+				{
+					latency.record(chrono::duration_cast<chrono::nanoseconds>(Clock::now() - begin).count());
+					done++;
+				}
+				else if (status.error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED)
+					throttled++;
+				else
+					errors++;
+			};
+
+			chrono::nanoseconds interval((int64_t) (1e9 * config.drivers / config.rate));
+			Clock::time_point next = load_start;
+			size_t turn = 0;
+			while (next < load_end)
+			{
+				this_thread::sleep_until(next);
+				next += interval;
+				VirtualUser *user = mine[turn++ % mine.size()];
+				Request request;
+				request.set_username(user->name);
+
+				double op = coin(local_rng);
+				if (op < config.list_fraction)
+				{
+					ListReply reply;
+					timed(list_latency[d], lists_done, [&](ClientContext *context) {
+						return user->stub->List(context, request, &reply);
+					});
+				}
+				else if ((op -= config.list_fraction) < config.follow_fraction && !user->following.empty())
+				{
+					size_t edge = local_rng() % user->following.size();
+					request.add_arguments(users[user->following[edge]].name);
+					Reply reply;
+					bool follow = user->unfollowed[edge];
+					timed(follow_latency[d], follows_done, [&](ClientContext *context) {
+						Status status = follow ? user->stub->Follow(context, request, &reply)
+											   : user->stub->Unfollow(context, request, &reply);
+						if (status.ok())
+							user->unfollowed[edge] = !follow;
+						return status;
+					});
+				}
+				else if ((op -= config.follow_fraction) < config.login_fraction)
+				{
+					Reply reply;
+					timed(login_latency[d], logins_done, [&](ClientContext *context) {
+						return user->stub->Login(context, request, &reply);
+					});
+				}
+				else
+				{
+					if (user->stream->Write(makePost(*user)))
+						posts_sent++;
+					else
+						errors++;
+				}
+			}
+		}));
+	}
+	for (thread &t : drivers)
+		t.join();
+	double load_seconds = chrono::duration<double>(Clock::now() - load_start).count();
+
+	// Give in-flight deliveries a moment, then tear the streams down
+	this_thread::sleep_for(chrono::seconds(1));
+	for (VirtualUser &user : users)
+		user.context->TryCancel();
+	for (VirtualUser &user : users)
+		user.reader.join();
+
+	LatencyHistogram delivery, lists, follows, logins;
+	uint64_t delivered = 0, acked = 0, rejected = 0;
+	for (VirtualUser &user : users)
+	{
+		rejected += user.rejected;
+		delivery.merge(user.delivery);
+		delivered += user.delivered;
+		acked += user.acked;
+	}
+	for (int d = 0; d < config.drivers; d++)
+	{
+		lists.merge(list_latency[d]);
+		follows.merge(follow_latency[d]);
+		logins.merge(login_latency[d]);
+	}
+
+	cout << "\n========= TSBENCH RESULTS =========\n";
+	cout << " clients " << config.clients << ", follow edges " << edges << ", target " << config.rate
+		 << " ops/s for " << config.duration << "s\n";
+	cout << " posts sent:        " << posts_sent << " (" << posts_sent / load_seconds << "/s), acked " << acked << ", rejected " << rejected << "\n";
+	cout << " deliveries:        " << delivered << " (" << delivered / load_seconds << "/s)\n";
+	cout << " post-to-delivery:  p50 " << formatNanos(delivery.percentile(0.50))
+		 << ", p99 " << formatNanos(delivery.percentile(0.99))
+		 << ", p999 " << formatNanos(delivery.percentile(0.999))
+		 << ", max " << formatNanos(delivery.max()) << "\n";
+	cout << " list:              " << lists_done << " calls, p50 " << formatNanos(lists.percentile(0.50))
+		 << ", p99 " << formatNanos(lists.percentile(0.99))
+		 << ", p999 " << formatNanos(lists.percentile(0.999)) << "\n";
+	cout << " follow/unfollow:   " << follows_done << " calls, p50 " << formatNanos(follows.percentile(0.50))
+		 << ", p99 " << formatNanos(follows.percentile(0.99))
+		 << ", p999 " << formatNanos(follows.percentile(0.999)) << "\n";
+	cout << " login:             " << logins_done << " calls, p50 " << formatNanos(logins.percentile(0.50))
+		 << ", p99 " << formatNanos(logins.percentile(0.99))
+		 << ", p999 " << formatNanos(logins.percentile(0.999)) << "\n";
+	cout << " throttled:         " << throttled << "\n";
+	cout << " errors:            " << errors << "\n";
+	cout << "===================================\n";
+
+	// One machine-readable line for tracking results between builds
+	cout << "tsbench-result posts_per_sec=" << posts_sent / load_seconds
+		 << " deliveries_per_sec=" << delivered / load_seconds
+		 << " delivery_p50_us=" << delivery.percentile(0.50) / 1000
+		 << " delivery_p99_us=" << delivery.percentile(0.99) / 1000
+		 << " delivery_p999_us=" << delivery.percentile(0.999) / 1000
+		 << " list_p99_us=" << lists.percentile(0.99) / 1000
+		 << " follow_p99_us=" << follows.percentile(0.99) / 1000
+		 << " login_p99_us=" << logins.percentile(0.99) / 1000
+		 << " rejected=" << rejected
+		 << " throttled=" << throttled
+		 << " errors=" << errors << endl;
+
+	if (server_group != 0)
+	{
+		killpg(server_group, SIGKILL);
+		while (waitpid(-server_group, NULL, 0) > 0);
+	}
+
+	// Fail the run if it is being used as a latency regression gate and the p99 regressed
+	if (config.gate_p99_ms > 0 && delivery.percentile(0.99) > config.gate_p99_ms * 1e6)
+	{
+		cerr << "tsbench: post-to-delivery p99 above the " << config.gate_p99_ms << "ms gate" << endl;
+		return 1;
+	}
+	return 0;
+}
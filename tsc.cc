@@ -1,443 +1,440 @@
-#include <netinet/in.h>
-#include <sys/socket.h>
-#include <arpa/inet.h>
-#include <iostream>
-#include <memory>
-#include <thread>
-#include <vector>
-#include <string>
-#include <unistd.h>
-#include <grpc++/grpc++.h>
-#include "client.h"
-
-#include "sns.grpc.pb.h"
-using csce438::ListReply;
-using csce438::Message;
-using csce438::Reply;
-using csce438::Request;
-using csce438::SNSService;
-using grpc::Channel;
-using grpc::ClientContext;
-using grpc::ClientReader;
-using grpc::ClientReaderWriter;
-using grpc::ClientWriter;
-using grpc::Status;
-
-using namespace std;
-
-// Function to make a gRPC Message instance given a username and message string
-Message MakeMessage(const string &username, const string &msg)
-{
-    // Create a message and set the username and message contents
-    Message m;
-    m.set_username(username);
-    m.set_msg(msg);
-
-    // Create a timestamp and populate it with the current time, then add it to the message
-    google::protobuf::Timestamp *timestamp = new google::protobuf::Timestamp();
-    timestamp->set_seconds(time(NULL));
-    timestamp->set_nanos(0);
-    m.set_allocated_timestamp(timestamp);
-
-    // Return the message
-    return m;
-}
-
-// Client class derives IClient
-class Client : public IClient
-{
-public:
-    Client(const string &raddr,
-           const string &uname,
-           const string &p)
-        : router_addr(raddr), username(uname), port(p) {}
-
-protected:
-    virtual int connectTo();
-    virtual IReply processCommand(string &input);
-    virtual void processTimeline();
-
-private:
-    string router_addr = "";
-    struct in_addr host_addr;
-    string username = "";
-    string port = "";
-    bool connected = false;
-    unique_ptr<SNSService::Stub> stub_;
-
-    IReply Login();
-    IReply List();
-    IReply Follow(const string &username2);
-    IReply Unfollow(const string &username2);
-    void Timeline(const string &username);
-};
-
-int main(int argc, char **argv)
-{
-    string router_addr = "127.0.0.1";
-    string username = "default";
-    string port = "3010";
-    int opt = 0;
-    while ((opt = getopt(argc, argv, "r:u:p:")) != -1)
-    {
-        switch (opt)
-        {
-        case 'r':
-            router_addr = optarg;
-            break;
-        case 'u':
-            username = optarg;
-            break;
-        case 'p':
-            port = optarg;
-            break;
-        default:
-            cerr << "Invalid Command Line Argument\n";
-        }
-    }
-
-    // Create new client instance with the given router address, username, and client port
-    Client myc(router_addr, username, port);
-
-    // You MUST invoke "run_client" function to start business logic
-    myc.run_client();
-
-    return 0;
-}
-
-// Exit the process with a message in the event of a fatal error
-void killSession(string error) 
-{
-	cerr << "\nCLIENT ERROR: " << error << endl;
-	cerr << "errno: " << errno << endl;
-	cerr << "Client encountered unrecoverable error!" << endl;
-	cerr << "Client shutting down..." << endl;
-	exit(EXIT_FAILURE);
-}
-
-// Connect to available master server if not already connected to available master
-int Client::connectTo()
-{   
-    int sock;
-    struct sockaddr_in addr;
-    struct in_addr temp_host;
-    char buf[1024];
-
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(stoi(port));
-
- 	if((sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
-		killSession("Socket error in connectTo()");
-	
-	// Convert router address from text to binary form and store in the struct
-    if(inet_pton(AF_INET, router_addr.c_str(), &addr.sin_addr) <= 0)  
-		killSession("Invalid router address in connectTo()");
-
-	// Connect to the router 
-	if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) 
-		killSession("connect() to router failed in connectTo()");
-
-    // Read the address of the available master into a temporary buffer  (router returns a single byte in the event that no master is available)
-    int status;
-    if ((status = read(sock, buf, 1024)) <= 0)
-        killSession("read() failed in connectTo()");
-    if (status == 1)
-    {
-        cout << "\nNo available masters for connection" << endl;
-        return -1;
-    }
-
-    // Translate address into network structure and store in temp_host
-    inet_pton(AF_INET, buf, &temp_host);
-
-    // If temporary host address doesn't equal the current host address
-    // set host address to temporary host address and do the following: 
-    if (temp_host.s_addr != host_addr.s_addr)
-    {
-        string host_str(buf);
-        
-        // If this is not the first connection attempt, display reconnection message
-        if(connected) 
-            displayReConnectionMessage(host_str, port);
-
-        string login_info = host_str + ":" + port;
-        #ifdef DEBUG
-            cout << "DEBUG: Attempting to connect to " << login_info << endl;
-        #endif
-        
-        // Connect to the server and login
-        stub_ = unique_ptr<SNSService::Stub>(SNSService::NewStub(
-            grpc::CreateChannel(
-                login_info, grpc::InsecureChannelCredentials())));
-
-        IReply ire = Login();
-        if (!ire.grpc_status.ok() || ire.comm_status != SUCCESS)
-            return -1;
-        
-        host_addr = temp_host;
-        connected = true;
-    }
-
-    // Else, do nothing (already connected to available master)
-    return 1;
-}
-
-// Processed a given input command LIST/FOLLOW/UNFOLLOW/TIMELINE
-IReply Client::processCommand(string &input)
-{
-    IReply ire;
-    size_t index = input.find_first_of(" ");
-    // Process commands with at least one argument (FOLLOW/UNFOLLOW)
-    if (index != string::npos)
-    {
-        string cmd = input.substr(0, index);
-        
-        if (input.length() == index + 1)
-            cout << "Invalid Input -- No Arguments Given\n";
-
-        string argument = input.substr(index + 1, (input.length() - index));
-
-        if (cmd == "FOLLOW")
-            return Follow(argument);
-
-        else if (cmd == "UNFOLLOW")
-            return Unfollow(argument);
-    }
-    // Process commands with no arguments (LIST/TIMELINE)
-    else
-    {
-        if (input == "LIST")
-            return List();
-        else if (input == "TIMELINE")
-        {
-            ire.comm_status = SUCCESS;
-            return ire;
-        }
-    }
-
-    ire.comm_status = FAILURE_INVALID;
-    return ire;
-}
-
-// Enter the users timeline
-void Client::processTimeline()
-{
-    Timeline(username);
-}
-
-// List all users, inclusing those following the current user
-IReply Client::List()
-{
-    // Data being sent to the server
-    Request request;
-    request.set_username(username);
-
-    // Container for the data from the server and current context
-    ListReply list_reply;
-    ClientContext context;
-
-    Status status = stub_->List(&context, request, &list_reply);
-    IReply ire;
-    ire.grpc_status = status;
-
-    // Loop through list_reply.all_users and list_reply.following_users
-    // Print out the name of each room
-    if (status.ok())
-    {
-        ire.comm_status = SUCCESS;
-        string all_users;
-        string following_users;
-        for (string s : list_reply.all_users())
-            ire.all_users.push_back(s);
-        for (string s : list_reply.followers())
-            ire.followers.push_back(s);
-    }
-    return ire;
-}
-
-// Follow a given user
-IReply Client::Follow(const string &username2)
-{
-    // Data being sent to the server
-    Request request;
-    request.set_username(username);
-    request.add_arguments(username2);
-
-    // Container for the data from the server and current context
-    Reply reply;
-    ClientContext context;
-
-    // Make the gRPC call and check the reply
-    Status status = stub_->Follow(&context, request, &reply);
-    IReply ire;
-    ire.grpc_status = status;
-    if (reply.msg() == "Follow Failed -- Invalid Username")
-        ire.comm_status = FAILURE_INVALID_USERNAME;
-    else if (reply.msg() == "Follow Failed -- Already Following User")
-        ire.comm_status = FAILURE_ALREADY_EXISTS;
-    else if (reply.msg() == "Follow Successful")
-        ire.comm_status = SUCCESS;
-    else
-        ire.comm_status = FAILURE_UNKNOWN;
-    return ire;
-}
-
-// Unfollow a given user
-IReply Client::Unfollow(const string &username2)
-{
-    // Data being sent to the server
-    Request request;
-    request.set_username(username);
-    request.add_arguments(username2);
-
-    // Container for the data from the server and current context
-    Reply reply;
-    ClientContext context;
-
-    // Make the gRPC call and check the reply
-    Status status = stub_->Unfollow(&context, request, &reply);
-    IReply ire;
-    ire.grpc_status = status;
-    if (reply.msg() == "Unfollow Failed -- Invalid Username")
-        ire.comm_status = FAILURE_INVALID_USERNAME;
-    else if (reply.msg() == "Unfollow Failed -- Not Following User")
-        ire.comm_status = FAILURE_INVALID_USERNAME;
-    else if (reply.msg() == "Unfollow Successful")
-        ire.comm_status = SUCCESS;
-    else
-        ire.comm_status = FAILURE_UNKNOWN;
-    return ire;
-}
-
-// Log in the current user
-IReply Client::Login()
-{
-    // Data being sent to the server
-    Request request;
-    request.set_username(username);
-
-    // Container for the data from the server and current context
-    Reply reply;
-    ClientContext context;
-
-    // Make the gRPC call and check the reply
-    Status status = stub_->Login(&context, request, &reply);
-    IReply ire;
-    ire.grpc_status = status;
-    if (reply.msg() == "Invalid Username")
-        ire.comm_status = FAILURE_ALREADY_EXISTS;
-    else
-        ire.comm_status = SUCCESS;
-
-    //cout << reply.msg() << endl;
-    return ire;
-}
-
-// Process the user's timeline, reconnecting to the available master whenever a connection is lost
-void Client::Timeline(const string &username)
-{
-    // Thread shared variables
-    static bool CONTINUE;
-    static string LAST_MSG = "";
-
-    while(true) 
-    {  
-        CONTINUE = true;
-        ClientContext context;
-
-        // Check if connected to current available master
-        if (connectTo() < 0)
-            killSession("Could not reconnect to available master");
-
-        // Create bi-directional stream
-        shared_ptr<ClientReaderWriter<Message, Message>> stream(
-            stub_->Timeline(&context));
-
-        //Thread used to read chat messages and send them to the server
-        thread writer([username, stream]() {
-            // Set the stream
-            string input = "Set Stream";
-            Message m = MakeMessage(username, input);
-            if (!stream->Write(m))
-            {
-                // If the write fails, signal the reader and exit the thread
-                #ifdef DEBUG
-                    cout << "Writer: Stream has been closed on first write, signalling reader and reconnecting..." << endl;
-                #endif
-                CONTINUE = false;
-                return 1;     
-            }
-
-            // If the writer was interrupted during the last run, try re-sending the last message the user provided
-            if (LAST_MSG != "")
-            {
-                Message m = MakeMessage(username, LAST_MSG);
-                if (!stream->Write(m))
-                {
-                    // If the write fails, signal the reader and exit the thread
-                    #ifdef DEBUG
-                        cout << "Writer: Stream has been closed on the re-write of the last message, signalling reader and reconnecting..." << endl;
-                    #endif
-                    CONTINUE = false;
-                    return 1;     
-                }
-                LAST_MSG = "";
-            }
-
-            // While the writer has not been signalled by the reader  
-            while (CONTINUE)
-            {
-                input = getPostMessage();
-                m = MakeMessage(username, input);
-                if (!stream->Write(m))
-                {
-                    // If the write fails, signal the reader and exit the thread, saving the last message the user wrote
-                    LAST_MSG = input;
-                    #ifdef DEBUG
-                        cout << "Writer: Stream has been closed on subsequent write, signalling reader and reconnecting..." << endl;
-                    #endif
-                    CONTINUE = false;
-                    return 1;
-                }
-            }        
-            stream->WritesDone();
-            return 0;
-        });
-
-        // Thread used to read messages from the server and print them for the client
-        thread reader([username, stream]() {
-            Message m;
-
-            // Continue reading until the writer signals or the stream fails
-            while (CONTINUE && stream->Read(&m))
-            {
-                google::protobuf::Timestamp temptime = m.timestamp();
-                time_t time = temptime.seconds();
-                displayPostMessage(m.username(), m.msg(), time);
-            }
-            // If the stream failed (writer did not signal)
-            if (CONTINUE)
-            {
-                // Signal the writer and exit the thread
-                CONTINUE = false;
-                #ifdef DEBUG
-                    cout << "Reader: Stream has been closed, reconnecting..." << endl;
-                #endif  
-            }
-            // If the writer signalled, exit the thread
-            else {
-                #ifdef DEBUG
-                    cout << "Reader: Received signal from writer, reconnecting..." << endl;
-                #endif
-            }
-            
-        });
-
-        //Wait for the threads to finish
-        writer.join();     
-        reader.join();
-        #ifdef DEBUG
-            cout << "Reader and writer done, reconnecting..." << endl;
-        #endif
-    }
-}
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <string>
+#include <unistd.h>
+#include <grpc++/grpc++.h>
+#include "client.h"
+#include "histogram.h"
+#include "timelinecache.h"
+#include "tsns_client.h"
+
+using csce438::Message;
+using grpc::Status;
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+// Client class derives IClient, a shell over a session of the client library
+class Client : public IClient
+{
+public:
+    Client(const string &raddr,
+           const string &uname,
+           const string &p,
+           const SnsClientOptions &options)
+        : client(raddr, p, options), session(client.session(uname))
+    {
+    }
+
+    // Non-interactive publishing of every line of a file (or stdin) as a post
+    int Publish(istream &in, unsigned batch_size, unsigned window);
+
+protected:
+    virtual int connectTo();
+    virtual IReply processCommand(string &input);
+    virtual void processTimeline();
+
+private:
+    SnsClient client;
+    shared_ptr<SnsSession> session;
+
+    IReply List();
+    IReply Follow(const string &username2);
+    IReply Unfollow(const string &username2);
+    IReply History(uint64_t before_post_id);
+    void Timeline();
+};
+
+int main(int argc, char **argv)
+{
+    string router_addr = "127.0.0.1";
+    string username = "default";
+    string port = "3010";
+    string publish_file = "";
+    unsigned batch_size = 32;
+    unsigned window = 1024;
+    SnsClientOptions options;
+    int opt = 0;
+    while ((opt = getopt(argc, argv, "r:u:p:f:n:w:Rd:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'r':
+            router_addr = optarg;
+            break;
+        case 'u':
+            username = optarg;
+            break;
+        case 'p':
+            port = optarg;
+            break;
+        case 'f':
+            publish_file = optarg;
+            break;
+        case 'n':
+            batch_size = max(1, atoi(optarg));
+            break;
+        case 'w':
+            window = max(1, atoi(optarg));
+            break;
+        case 'R':
+            options.replica_reads = true;
+            break;
+        case 'd':
+            options.deadline_ms = max(1, atoi(optarg));
+            break;
+        default:
+            cerr << "Invalid Command Line Argument\n";
+        }
+    }
+
+    // Create new client instance with the given router addresses, username, and client port
+    Client myc(router_addr, username, port, options);
+
+    // Bulk publish mode, "-f -" reads posts from stdin
+    if (publish_file == "-")
+        return myc.Publish(cin, batch_size, window);
+    else if (publish_file != "")
+    {
+        ifstream in(publish_file);
+        if (!in)
+        {
+            cerr << "Could not open " << publish_file << endl;
+            return 1;
+        }
+        return myc.Publish(in, batch_size, window);
+    }
+
+    // You MUST invoke "run_client" function to start business logic
+    myc.run_client();
+
+    return 0;
+}
+
+// Exit the process with a message in the event of a fatal error
+void killSession(string error) 
+{
+	cerr << "\nCLIENT ERROR: " << error << endl;
+	cerr << "errno: " << errno << endl;
+	cerr << "Client encountered unrecoverable error!" << endl;
+	cerr << "Client shutting down..." << endl;
+	exit(EXIT_FAILURE);
+}
+
+
+// Connect to the available master (logging in again, see SnsSession::connect())
+int Client::connectTo()
+{
+    switch (session->connect())
+    {
+    case SnsSession::NO_ROUTER:
+        killSession("connect() to router failed in connectTo()");
+        return -1;
+    case SnsSession::NO_MASTER:
+        cout << "\nNo available masters for connection" << endl;
+        return -1;
+    case SnsSession::LOGIN_FAILED:
+        return -1;
+    case SnsSession::CONNECTED_NEW:
+    {
+        string master = session->master();
+        size_t colon = master.rfind(':');
+        displayReConnectionMessage(master.substr(0, colon), master.substr(colon + 1));
+        return 1;
+    }
+    default:
+        return 1;
+    }
+}
+
+// Processed a given input command LIST/FOLLOW/UNFOLLOW/TIMELINE
+IReply Client::processCommand(string &input)
+{
+    IReply ire;
+    size_t index = input.find_first_of(" ");
+    // Process commands with at least one argument (FOLLOW/UNFOLLOW)
+    if (index != string::npos)
+    {
+        string cmd = input.substr(0, index);
+        
+        if (input.length() == index + 1)
+            cout << "Invalid Input -- No Arguments Given\n";
+
+        string argument = input.substr(index + 1, (input.length() - index));
+
+        if (cmd == "FOLLOW")
+            return Follow(argument);
+
+        else if (cmd == "UNFOLLOW")
+            return Unfollow(argument);
+
+        else if (cmd == "HISTORY")
+            return History(strtoull(argument.c_str(), NULL, 10));
+    }
+    // Process commands with no arguments (LIST/TIMELINE/HISTORY)
+    else
+    {
+        if (input == "LIST")
+            return List();
+        else if (input == "HISTORY")
+            return History(0);
+        else if (input == "TIMELINE")
+        {
+            ire.comm_status = SUCCESS;
+            return ire;
+        }
+    }
+
+    ire.comm_status = FAILURE_INVALID;
+    return ire;
+}
+
+// Enter the users timeline
+void Client::processTimeline()
+{
+    Timeline();
+}
+
+// List all users, inclusing those following the current user
+IReply Client::List()
+{
+    ListResult result = session->list().get();
+    IReply ire;
+    ire.grpc_status = result.status;
+    if (result.status.ok())
+    {
+        ire.comm_status = SUCCESS;
+        ire.all_users = result.all_users;
+        ire.followers = result.followers;
+    }
+    return ire;
+}
+
+// Follow a given user
+IReply Client::Follow(const string &username2)
+{
+    CommandResult result = session->follow(username2).get();
+    IReply ire;
+    ire.grpc_status = result.status;
+    if (result.msg == "Follow Failed -- Invalid Username")
+        ire.comm_status = FAILURE_INVALID_USERNAME;
+    else if (result.msg == "Follow Failed -- Already Following User")
+        ire.comm_status = FAILURE_ALREADY_EXISTS;
+    else if (result.msg == "Follow Successful")
+        ire.comm_status = SUCCESS;
+    else
+        ire.comm_status = FAILURE_UNKNOWN;
+    return ire;
+}
+
+// Unfollow a given user
+IReply Client::Unfollow(const string &username2)
+{
+    CommandResult result = session->unfollow(username2).get();
+    IReply ire;
+    ire.grpc_status = result.status;
+    if (result.msg == "Unfollow Failed -- Invalid Username")
+        ire.comm_status = FAILURE_INVALID_USERNAME;
+    else if (result.msg == "Unfollow Failed -- Not Following User")
+        ire.comm_status = FAILURE_INVALID_USERNAME;
+    else if (result.msg == "Unfollow Successful")
+        ire.comm_status = SUCCESS;
+    else
+        ire.comm_status = FAILURE_UNKNOWN;
+    return ire;
+}
+
+// Display a page of the posts of the users we follow, older than the given post id (0 for the newest)
+IReply Client::History(uint64_t before_post_id)
+{
+    HistoryResult result = session->history(before_post_id).get();
+    IReply ire;
+    ire.grpc_status = result.status;
+    if (!result.status.ok())
+        return ire;
+    for (const Message &m : result.posts)
+    {
+        time_t time = m.timestamp().seconds();
+        cout << "#" << m.post_id() << " ";
+        displayPostMessage(m.username(), m.msg(), time);
+    }
+    if (result.next_before_post_id != 0)
+        cout << "Older posts: HISTORY " << result.next_before_post_id << endl;
+    ire.comm_status = SUCCESS;
+    return ire;
+}
+
+// Process the user's timeline, reconnecting to the available master whenever the stream is lost
+// (posts not acknowledged yet are re-sent by the session, and the server drops any it has already seen)
+void Client::Timeline()
+{
+    // Read input on a thread of its own, posting each line once the previous one is on the master
+    thread([this]() {
+        while (true)
+        {
+            string input = getPostMessage();
+            PublishResult result = session->publish(input).get();
+            // The server turned the post away, tell the user rather than retrying behind their back
+            if (!result.accepted)
+                cout << "Server busy, post not sent (try again in " << result.retry_after_ms
+                     << " ms): " << input;
+        }
+    }).detach();
+
+    // Show the posts cached from the last stream to this master right away, it then only sends the newer ones
+    TimelineCache cache;
+    string cached_master = "";
+    while (true)
+    {
+        if (session->master() != cached_master)
+        {
+            cached_master = session->master();
+            cache.open(timelineCachePath(session->username(), cached_master));
+            for (const Message &m : cache.posts())
+            {
+                time_t time = m.timestamp().seconds();
+                displayPostMessage(m.username(), m.msg(), time);
+            }
+        }
+
+        uint64_t cached_post_id = cache.newest();
+        future<Status> stream = session->subscribe([&cache, cached_post_id](const Message &m) {
+            // A post the master should not have sent: its feed was started over since the posts were cached
+            if (m.post_id() != 0 && m.post_id() <= cached_post_id && m.post_id() <= cache.newest())
+                cache.clear();
+            cache.add(m);
+            time_t time = m.timestamp().seconds();
+            displayPostMessage(m.username(), m.msg(), time);
+        }, cached_post_id);
+        Status status = stream.get();
+        #ifdef DEBUG
+            cout << "Timeline stream closed (" << status.error_message() << "), reconnecting..." << endl;
+        #endif
+        // The master turned the stream away (too many open), come back once it says to
+        if (retryLater(status))
+            this_thread::sleep_for(chrono::milliseconds(backoffMs(session->streamRetryAfterMs())));
+        if (connectTo() < 0)
+            killSession("Could not reconnect to available master");
+    }
+}
+
+// Publish every non-empty line of the input as a post without any interaction
+// Posts are published in batches of batch_size (written together) with up to window posts
+// awaiting acknowledgement, reconnecting whenever the stream fails (the session re-sends the
+// unacknowledged posts)
+// Posts the server turns away (rate limited) are published again once the retry hint has passed
+int Client::Publish(istream &in, unsigned batch_size, unsigned window)
+{
+    struct InFlight
+    {
+        future<PublishResult> result;
+        Clock::time_point sent_at;
+        string text;
+    };
+    deque<InFlight> inflight;
+    // Turned away posts, each due once the hint after the previous one has passed
+    deque<pair<Clock::time_point, string>> retries;
+    Clock::time_point last_retry;
+    LatencyHistogram latency;
+    uint64_t published = 0;
+    uint64_t throttled = 0;
+    bool input_done = false;
+    string line;
+
+    if (window < batch_size)
+        window = batch_size;
+
+    if (connectTo() < 0)
+        killSession("Could not connect to available master");
+    future<Status> stream = session->subscribe(nullptr);
+
+    Clock::time_point start = Clock::now();
+    while (!input_done || !inflight.empty() || !retries.empty())
+    {
+        if (stream.wait_for(chrono::seconds(0)) == future_status::ready)
+        {
+            Status status = stream.get();
+            cerr << "Stream failed (" << status.error_message() << "), re-sending "
+                 << session->pending() << " unacknowledged posts..." << endl;
+            if (retryLater(status))
+                this_thread::sleep_for(chrono::milliseconds(backoffMs(session->streamRetryAfterMs())));
+            if (connectTo() < 0)
+                killSession("Could not reconnect to available master");
+            stream = session->subscribe(nullptr);
+        }
+
+        // Publish the next batch (due retries first) while the window has room for it
+        vector<string> batch;
+        Clock::time_point now = Clock::now();
+        if (inflight.size() + batch_size <= window)
+        {
+            while (!retries.empty() && retries.front().first <= now && batch.size() < batch_size)
+            {
+                batch.push_back(retries.front().second);
+                retries.pop_front();
+            }
+            while (!input_done && batch.size() < batch_size)
+            {
+                if (!getline(in, line))
+                    input_done = true;
+                else if (!line.empty())
+                    batch.push_back(line);
+            }
+        }
+        if (!batch.empty())
+        {
+            vector<future<PublishResult>> results = session->publish(batch);
+            for (size_t i = 0; i < batch.size(); i++)
+            {
+                InFlight posted;
+                posted.result = move(results[i]);
+                posted.sent_at = now;
+                posted.text = batch[i];
+                inflight.push_back(move(posted));
+            }
+            continue;
+        }
+
+        // Wait for the oldest post (checking on the stream and the retries meanwhile)
+        if (inflight.empty())
+        {
+            if (!retries.empty())
+                this_thread::sleep_until(retries.front().first);
+            continue;
+        }
+        if (inflight.front().result.wait_for(chrono::milliseconds(10)) != future_status::ready)
+            continue;
+        InFlight done = move(inflight.front());
+        inflight.pop_front();
+        PublishResult result = done.result.get();
+        if (result.accepted)
+        {
+            latency.record(chrono::duration_cast<chrono::nanoseconds>(Clock::now() - done.sent_at).count());
+            published++;
+            continue;
+        }
+        // The hint is when the next post would be accepted, so space the retries out by it
+        last_retry = max(Clock::now(), last_retry) + chrono::milliseconds(result.retry_after_ms);
+        retries.push_back(make_pair(last_retry, done.text));
+        throttled++;
+    }
+    session->close();
+
+    double seconds = chrono::duration<double>(Clock::now() - start).count();
+    cout << "Published " << published << " posts in " << seconds << "s ("
+         << (seconds > 0 ? published / seconds : 0) << " posts/s)" << endl;
+    cout << "Ack latency: p50 " << formatNanos(latency.percentile(0.50))
+         << ", p90 " << formatNanos(latency.percentile(0.90))
+         << ", p99 " << formatNanos(latency.percentile(0.99))
+         << ", p99.9 " << formatNanos(latency.percentile(0.999))
+         << ", max " << formatNanos(latency.max()) << endl;
+    if (throttled != 0)
+        cout << "Server turned away " << throttled << " posts (rate limited), all were re-sent" << endl;
+    return 0;
+}
@@ -1,680 +1,1249 @@
-/*
- *
- * Copyright 2015, Google Inc.
- * All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are
- * met:
- *
- *     * Redistributions of source code must retain the above copyright
- * notice, this list of conditions and the following disclaimer.
- *     * Redistributions in binary form must reproduce the above
- * copyright notice, this list of conditions and the following disclaimer
- * in the documentation and/or other materials provided with the
- * distribution.
- *     * Neither the name of Google Inc. nor the names of its
- * contributors may be used to endorse or promote products derived from
- * this software without specific prior written permission.
- *
- * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
- * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
- * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
- * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
- * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
- * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
- * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
- * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
- * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
- * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *
- */
-
-#include <ctime>
-
-#include <google/protobuf/timestamp.pb.h>
-#include <google/protobuf/duration.pb.h>
-
-#include <netinet/in.h>
-#include <sys/socket.h>
-#include <arpa/inet.h>
-#include <sys/wait.h>
-#include <fstream>
-#include <iostream>
-#include <algorithm>
-#include <thread>
-#include <memory>
-#include <queue>
-#include <string>
-#include <stdlib.h>
-#include <unistd.h>
-#include <google/protobuf/util/time_util.h>
-#include <grpc++/grpc++.h>
-
-#include "sns.grpc.pb.h"
-
-using csce438::ListReply;
-using csce438::Message;
-using csce438::Reply;
-using csce438::Request;
-using csce438::SNSService;
-using google::protobuf::Duration;
-using google::protobuf::Timestamp;
-using grpc::Server;
-using grpc::ServerBuilder;
-using grpc::ServerContext;
-using grpc::ServerReader;
-using grpc::ServerReaderWriter;
-using grpc::ServerWriter;
-using grpc::Status;
-
-using namespace std; 
-
-struct Client
-{
-	string username;
-	bool connected = true;
-	int following_file_size = 0;
-	vector<Client *> client_followers;
-	vector<Client *> client_following;
-	ServerReaderWriter<Message, Message> *stream = 0;
-
-	bool operator==(const Client &c1) const {
-		return (username == c1.username);
-	}
-};
-
-//Vector that stores every client that has been created
-vector<Client> client_db;
-
-// Exit the process with a message in the event of a fatal error
-void killSession(string error) 
-{
-	cerr << "\nMASTER ERROR: " << error << " (errno " << errno << ")" << endl;
-	cerr << "Master encountered unrecoverable error" << endl;
-	cerr << "Server shutting down..." << endl;
-	exit(EXIT_FAILURE);
-}
-
-//Helper function used to find a Client object given its username
-int find_user(string username)
-{
-	int index = 0;
-	for (Client c : client_db)
-	{
-		if (c.username == username)
-			return index;
-		index++;
-	}
-	return -1;
-}
-
-class SNSServiceImpl final : public SNSService::Service
-{
-
-	Status List(ServerContext *context, const Request *request, ListReply *list_reply) override
-	{
-		Client user = client_db[find_user(request->username())];
-		for (Client c : client_db)
-		{
-			list_reply->add_all_users(c.username);
-		}
-		vector<Client *>::const_iterator it;
-		for (it = user.client_followers.begin(); it != user.client_followers.end(); it++)
-		{
-			list_reply->add_followers((*it)->username);
-		}
-		return Status::OK;
-	}
-
-	Status Follow(ServerContext *context, const Request *request, Reply *reply) override
-	{
-		string username1 = request->username();
-		string username2 = request->arguments(0);
-		int join_index = find_user(username2);
-		if (join_index < 0 || username1 == username2)
-			reply->set_msg("Follow Failed -- Invalid Username");
-		else
-		{
-			Client *user1 = &client_db[find_user(username1)];
-			Client *user2 = &client_db[join_index];
-			if (find(user1->client_following.begin(), user1->client_following.end(), user2) != user1->client_following.end())
-			{
-				reply->set_msg("Follow Failed -- Already Following User");
-				return Status::OK;
-			}
-			user1->client_following.push_back(user2);
-			user2->client_followers.push_back(user1);
-			reply->set_msg("Follow Successful");
-		}
-		return Status::OK;
-	}
-
-	Status Unfollow(ServerContext *context, const Request *request, Reply *reply) override
-	{
-		string username1 = request->username();
-		string username2 = request->arguments(0);
-		int leave_index = find_user(username2);
-		if (leave_index < 0 || username1 == username2)
-			reply->set_msg("Unfollow Failed -- Invalid Username");
-		else
-		{
-			Client *user1 = &client_db[find_user(username1)];
-			Client *user2 = &client_db[leave_index];
-			if (find(user1->client_following.begin(), user1->client_following.end(), user2) == user1->client_following.end())
-			{
-				reply->set_msg("Unfollow Failed -- Not Following User");
-				return Status::OK;
-			}
-			user1->client_following.erase(find(user1->client_following.begin(), user1->client_following.end(), user2));
-			user2->client_followers.erase(find(user2->client_followers.begin(), user2->client_followers.end(), user1));
-			reply->set_msg("Unfollow Successful");
-		}
-		return Status::OK;
-	}
-
-	Status Login(ServerContext *context, const Request *request, Reply *reply) override
-	{
-		Client c;
-		string username = request->username();
-		int user_index = find_user(username);
-		if (user_index < 0)
-		{
-			c.username = username;
-			client_db.push_back(c);
-			reply->set_msg("Login Successful!");
-		}
-		else
-		{
-			Client *user = &client_db[user_index];
-			if (user->connected)
-				reply->set_msg("Invalid Username");
-			else
-			{
-				string msg = "Welcome Back " + user->username;
-				reply->set_msg(msg);
-				user->connected = true;
-			}
-		}
-		return Status::OK;
-	}
-
-	Status Timeline(ServerContext *context,
-					ServerReaderWriter<Message, Message> *stream) override
-	{
-		Message message;
-		Client *c;
-		while (stream->Read(&message))
-		{
-			string username = message.username();
-			int user_index = find_user(username);
-			if (user_index > -1)
-			{
-				#ifdef DEBUG
-					cout << "Found user " << username << endl;
-					cout << "(user index: " << user_index << ", max index: " << client_db.size() - 1 << ")" << endl;
-				#endif
-				c = &client_db[user_index];
-			}
-			else 
-			{
-				#ifdef DEBUG
-					cout << "Could not find user " << username << "!" << endl;
-				#endif		
-				string ret_msg = "Username \"" + username + "\" not registered!";
-				killSession(ret_msg);		
-			}
-
-			//Write the current message to "username.txt"
-			string filename = username + ".txt";
-			ofstream user_file(filename, ios::app | ios::out | ios::in);
-			google::protobuf::Timestamp temptime = message.timestamp();
-			string time = google::protobuf::util::TimeUtil::ToString(temptime);
-			string fileinput = time + " :: " + message.username() + ":" + message.msg() + "\n";
-			//"Set Stream" is the default message from the client to initialize the stream
-			if (message.msg() != "Set Stream")
-				user_file << fileinput;
-			//If message = "Set Stream", print the first 20 chats from the people you follow
-			else
-			{
-				//if (c->stream == 0)
-					c->stream = stream;
-				string line;
-				vector<string> newest_twenty;
-				ifstream in(username + "following.txt");
-				if (in)
-				{
-					int count = 0;
-					//Read the last up-to-20 lines (newest 20 messages) from userfollowing.txt
-					while (getline(in, line))
-					{
-						if (c->following_file_size > 20)
-						{
-							if (count < c->following_file_size - 20)
-							{
-								count++;
-								continue;
-							}
-						}
-						newest_twenty.push_back(line);
-					}
-				
-					Message new_msg;
-					//Send the newest messages to the client to be displayed
-					for (unsigned i = 0; i < newest_twenty.size(); i++)
-					{
-						new_msg.set_msg(newest_twenty[i]);
-						stream->Write(new_msg);
-					}
-					continue;
-				}
-			}
-			//Send the message to each follower's stream
-			vector<Client *>::const_iterator it;
-			for (it = c->client_followers.begin(); it != c->client_followers.end(); it++)
-			{
-				Client *temp_client = *it;
-				if (temp_client->stream != 0 && temp_client->connected)
-					temp_client->stream->Write(message);
-				//For each of the current user's followers, put the message in their following.txt file
-				string temp_username = temp_client->username;
-				string temp_file = temp_username + "following.txt";
-				ofstream following_file(temp_file, ios::app | ios::out | ios::in);
-				following_file << fileinput;
-				temp_client->following_file_size++;
-				ofstream user_file(temp_username + ".txt", ios::app | ios::out | ios::in);
-				user_file << fileinput;
-			}
-		}
-		//If the client disconnected from Chat Mode, set connected to false
-		c->connected = false;
-		return Status::OK;
-	}
-};
-
-// Function to register master server with router by sending the message 'MASTER'
-void registerMaster(const char* router_addr, string backend_port)
-{
-	int sock;
-	struct sockaddr_in addr;
-	const char* register_msg = "MASTER";
-
-	addr.sin_family = AF_INET;
-	addr.sin_port = htons(stoi(backend_port));
-
-	if((sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
-		killSession("Socket error in registerMaster()");
-	
-	// Convert router address from text to binary form and store in the struct
-    if(inet_pton(AF_INET, router_addr, &addr.sin_addr) <= 0)  
-		killSession("Invalid router address in registerMaster()");
-
-	// Connect to the router 
-	if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) 
-		killSession("connect() to router failed in registerMaster()");
-	
-	// Send message 'MASTER' to router
-	send(sock, register_msg, strlen(register_msg), 0);
-	close(sock);
-
-	#ifdef DEBUG
-		cout << "MSTR-DEBUG: Sent registration to router" << endl;
-	#endif
-}
-
-// Function to reap slave process on termination to avoid creating a defunct process
-void reap(int signum) 
-{
-	wait(NULL);
-}
-
-// Function to maintain heartbeat message with slave server
-void heartbeat(const char* router_addr, string client_port, string backend_port, string heartbeat_port) 
-{
-	int h_sock, b_sock, slave;
-	struct sockaddr_in h_addr, b_addr;
-	int addr_len = sizeof(h_addr);
-	const char* heartbeat_msg = "ALIVE";
-	const char* dead_msg = "DEAD";
-	char buf[1024] = {0};
-
-	h_addr.sin_family = b_addr.sin_family = AF_INET;
-	h_addr.sin_addr.s_addr = INADDR_ANY;
-	h_addr.sin_port = htons(stoi(heartbeat_port));
-	b_addr.sin_port = htons(stoi(backend_port));
-
-	if((h_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0 || (b_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
-		killSession("Socket error in heartbeat()");
-
-	int opt = 1;
-	if((setsockopt(h_sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &opt, sizeof(opt))) < 0)
-		killSession("setsockopt() failed in heartbeat()");
-    
-	#ifdef DEBUG
-		cout << "MSTR-DEBUG: Router address: " << router_addr << endl;
-	#endif
-
-	// Convert router address from text to binary form and store in the struct
-    if(inet_pton(AF_INET, router_addr, &b_addr.sin_addr) <= 0)  
-		killSession("Invalid router address in heartbeat()");
-
-	cout << "Master connecting to router... ";
-	if (connect(b_sock, (struct sockaddr *)&b_addr, sizeof(b_addr)) < 0) 
-		killSession("connect() to router failed in heartbeat()");
-	cout << "connected!" << endl;
-	
-	// Start listening for heartbeats from slave
-	if(bind(h_sock, (struct sockaddr*) &h_addr, sizeof(h_addr)) < 0)
-		killSession("bind() failed in heartbeat()");
-
-	if (listen(h_sock, 1) < 0) 
-		killSession("listen() failed in heartbeat()");
-
-	cout << "Master accepting connection from slave... ";
-    if ((slave = accept(h_sock, (struct sockaddr *)&h_addr, (socklen_t*)&addr_len)) < 0) 
-		killSession("accept() failed in heartbeat()");
-	cout << "accepted!" << endl;
-
-	// Set timeout on heartbeat reads to 5 seconds
-	// This is the inactivity threshold for rebooting the slave
-	struct timeval tv;
-	tv.tv_sec = 5;
-	tv.tv_usec = 0;
-	if((setsockopt(slave, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv))) < 0)
-		killSession("setsockopt() failed in heartbeat()");
-	
-	cout << "Master initialization complete, beginning keepalive." << endl;
-	int status;
-	while (true)
-	{
-		// Send heartbeat to slave
-    	send(slave, heartbeat_msg, strlen(heartbeat_msg), 0); 
-
-		// Attempt to read heartbeat from slave
-    	status = read(slave, buf, 1024); 
-		if (status <= 0)
-		{
-			#ifdef DEBUG
-				cout << "MSTR-DEBUG: Failed to receive heartbeat message from slave" << endl;
-			#endif
-			
-			// Disconnect all clients
-			for (Client client : client_db)
-				client.connected = false;
-
-			// Disconnect slave
-			close(slave);	
-
-			// Send message informing router of the slaves death
-			// send(b_sock, dead_msg, strlen(dead_msg), 0);	
-
-			// Close if still running and restart the slave via fork()/exec()
-			system("pkill -f tsds");
-			if(fork() == 0)
-			{
-				close(h_sock);
-				close(b_sock);
-
-				#ifdef DEBUG
-					cout << "MSTR-DEBUG: Processed spawned to resurrect slave" << endl;
-				#endif
-				const char* args[] = {"./tsds", "-h", heartbeat_port.c_str(), "-c", client_port.c_str(), "-b", backend_port.c_str(), "-a", router_addr, NULL};
-				execvp(args[0], (char**) args);
-				killSession("exec() failure");
-			} else // Set up signal handler
-			{
-				signal(SIGCHLD, reap);
-			}
-			
-			// Wait for slave to reboot
-			sleep(2);
-
-			// Wait for slave to re-connect
-			if ((slave = accept(h_sock, (struct sockaddr *)&h_addr, (socklen_t*)&addr_len)) < 0) 
-				killSession("accept() failed in heartbeat()");
-			cout << "Accepted slave reconnection" << endl;
-
-			if((setsockopt(slave, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv))) < 0)
-				killSession("setsockopt() failed in heartbeat()");
-
-			#ifdef DEBUG
-				cout << "MSTR-DEBUG: Restarted slave successfully, re-registering with router" << endl;
-			#endif
-			
-			// Re-register with router
-			registerMaster(router_addr, backend_port);
-			continue;
-		}
-
-		// Don't flood slave with heartbeat messages
-		sleep(1);
-	}
-}
-
-// Function to route clients to available registered master servers and manage available masters
-void route(string client_port, string backend_port) 
-{
-	vector<struct in_addr> hierarchy;
-	vector<int> servers;
-	vector<struct sockaddr_in> server_addrs;
-	char buf[1024];
-
-	int b_sock, c_sock;
-	struct sockaddr_in b_addr, c_addr;
-	int addr_len = sizeof(b_addr);
-
-	c_addr.sin_family = b_addr.sin_family = AF_INET;
-	c_addr.sin_addr.s_addr = b_addr.sin_addr.s_addr = INADDR_ANY;
-	c_addr.sin_port = htons(stoi(client_port));
-	b_addr.sin_port = htons(stoi(backend_port));
-
-	// Create server socket on client and backend ports
-	if((b_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0 || (c_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
-		killSession("Socket error in route()");
-	
-	int opt = 1;
-	if((setsockopt(b_sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &opt, sizeof(opt))) < 0)
-		killSession("setsockopt() failed in route()");
-
-	if((setsockopt(c_sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &opt, sizeof(opt))) < 0)
-		killSession("setsockopt() failed in route()");
-
-	if((bind(b_sock, (struct sockaddr*) &b_addr, sizeof(b_addr)) < 0) || (bind(c_sock, (struct sockaddr*) &c_addr, sizeof(c_addr)) < 0))
-		killSession("Could not successfully bind sockets in route()");
-
-	// Listen for connection requests on backend (for masters/slaves) and client (for clients) ports
-	if ((listen(b_sock, 128) < 0) || (listen(c_sock, 128) < 0)) 
-		killSession("listen() failed in route()");
-	
-	fd_set readfds;
-	while(true)
-	{
-		int maxfd = max(b_sock, c_sock);
-		FD_ZERO(&readfds);
-		FD_SET(b_sock, &readfds);
-		FD_SET(c_sock, &readfds);
-
-		for (auto sock : servers) 
-		{
-			if (sock > maxfd) maxfd = sock;
-			FD_SET(sock, &readfds);
-		}
-
-		if (select(maxfd + 1, &readfds, NULL, NULL, NULL) < 0) 
-            killSession("select failed in route()");
-
-
-		// Accept connection requests from masters/slaves
-		if (FD_ISSET(b_sock, &readfds)) 
-		{
-			int temp = accept(b_sock, (struct sockaddr*)&b_addr, (socklen_t*)&addr_len);
-			if (temp < 0) 
-				killSession("accept() failed in route()");
-			else
-			{
-				// Listen for future communication from newly connected server
-				servers.push_back(temp);
-				server_addrs.push_back(b_addr);
-			}
-		}
-
-		// Check among connected servers for new messages
-		for(unsigned i = 0; i < servers.size(); i++)
-		{
-			if (FD_ISSET(servers[i], &readfds)) 
-			{
-				// Read the new message
-				int status = read(servers[i], buf, 1024); 
-				if (status < 0)
-					killSession("read() failed in route()");
-				else if (status == 0) // Disconnection
-				{
-					close(servers[i]);
-					servers.erase(servers.begin() + i);
-					server_addrs.erase(server_addrs.begin() + i);
-					i--;
-					continue;
-				}
-				else if (buf[0] == 'M') // Register master
-				{
-					// Add ipv4 of servers[i] to the bottom of the hierarchy of available masters
-					hierarchy.push_back(server_addrs.at(i).sin_addr);
-					#ifdef DEBUG
-						cout << "RTR-DEBUG:  Registered master #" << hierarchy.size() << endl;
-					#endif
-				}
-				else if (buf[0] == 'D') // Reporting dead master/slave
-				{
-					#ifdef DEBUG
-						cout << "RTR-DEBUG:  About to remove master, pool size: " << hierarchy.size() << endl;
-					#endif
-					// Remove server from the hierarchy of available masters
-					for (int j = hierarchy.size() - 1; j >= 0; j--)
-					{
-						if (hierarchy.at(j).s_addr == server_addrs.at(i).sin_addr.s_addr)
-							hierarchy.erase(hierarchy.begin() + j);
-					}
-					#ifdef DEBUG
-						cout << "RTR-DEBUG:  Removed master, new pool size: " << hierarchy.size() << endl;
-					#endif
-				} 
-				else
-				{
-					#ifdef DEBUG
-						cout << "RTR-DEBUG:  Unknown router request: ";
-						printf("%.*s\n", status, buf);
-					#endif
-				}
-			}
-		}
-
-		// If a new client connects
-		if (FD_ISSET(c_sock, &readfds)) 
-		{
-			#ifdef DEBUG
-				cout << "RTR-DEBUG:  Client socket set" << endl;
-			#endif
-
-			// Accept the client connection
-			int temp = accept(c_sock, (struct sockaddr*)&c_addr, (socklen_t*)&addr_len);
-			if (temp < 0) 
-				killSession("accept() failed in route()");
-			
-			// If there are masters available
-			if (hierarchy.size() != 0)
-			{
-				char ip[INET_ADDRSTRLEN];
-
-				// Convert the available master's address to string format
-				if (inet_ntop(AF_INET, &hierarchy.at(0), ip, INET_ADDRSTRLEN) <= 0)
-					killSession("Failed to convert address to string in route()");
-
-				// Send the client the address of the available master
-				send(temp, ip, INET_ADDRSTRLEN, 0);
-				#ifdef DEBUG
-					cout << "RTR-DEBUG:  Directed client to available master" << endl;
-				#endif
-			}
-			// If there are no available masters, send a single byte
-			else 
-			{
-				send(temp, "0", 1, 0);
-				#ifdef DEBUG
-					cout << "RTR-DEBUG:  No masters available, could not direct client to available master" << endl;
-				#endif				
-			}
-
-			// Close the client connection
-			close(temp);	
-		}
-	}
-}
-
-// Run the gRPC client server
-void runServer(string client_port)
-{
-	string server_address = "0.0.0.0:" + client_port;
-	SNSServiceImpl service;
-
-	ServerBuilder builder;
-	builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-	builder.RegisterService(&service);
-	unique_ptr<Server> server(builder.BuildAndStart());
-	cout << "Server listening for client requests on " << server_address << endl;
-
-	server->Wait();
-}
-
-int main(int argc, char **argv)
-{
-	string client_port = "3010";
-	string backend_port = "3059";
-	string heartbeat_port = "3076";
-	string router_address = "127.0.0.1";
-
-	int opt = 0;
-
-	while ((opt = getopt(argc, argv, "c:h:b:a:")) != -1)
-	{
-		switch (opt)
-		{
-		case 'c':
-			client_port = optarg;
-			break;
-		case 'h':
-			heartbeat_port = optarg;
-			break;
-		case 'b':
-			backend_port = optarg;
-			break;
-		case 'a':
-			router_address = optarg;
-			break;
-		default:
-			cerr << "Invalid Command Line Argument\n";
-			return -1;
-		}
-	}
-
-	// Cannot operate when ports collide
-	if (client_port == backend_port || client_port == heartbeat_port || heartbeat_port == backend_port)
-		killSession("Invalid port selection, conflicting ports");
-
-	// Start heartbeat thread to monitor slave
-	thread monitor(heartbeat, router_address.c_str(), client_port, backend_port, heartbeat_port);
-
-	// If the server will operate as a router, route().
-	if (router_address == "127.0.0.1")
-		route(client_port, backend_port);
-	// Otherwise, register with router and run the client server
-	else
-	{
-		registerMaster(router_address.c_str(), backend_port);
-		runServer(client_port);
-	}
-
-	monitor.join();
-	return 0;
-}
-
+/*
+ *
+ * Copyright 2015, Google Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above
+ * copyright notice, this list of conditions and the following disclaimer
+ * in the documentation and/or other materials provided with the
+ * distribution.
+ *     * Neither the name of Google Inc. nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <ctime>
+
+#include <google/protobuf/timestamp.pb.h>
+#include <google/protobuf/duration.pb.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <arpa/inet.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <stdlib.h>
+#include <unistd.h>
+#include <grpc++/grpc++.h>
+
+#include "capture.h"
+#include "compaction.h"
+#include "handoff.h"
+#include "health.h"
+#include "log.h"
+#include "metrics.h"
+#include "replication.h"
+#include "router.h"
+#include "sns.grpc.pb.h"
+#include "server.h"
+#include "supervisor.h"
+
+using csce438::ListReply;
+using csce438::Message;
+using csce438::Reply;
+using csce438::Request;
+using csce438::SNSService;
+using csce438::TimelinePage;
+using csce438::TimelineRequest;
+using google::protobuf::Duration;
+using google::protobuf::Timestamp;
+using grpc::Server;
+using grpc::ServerBuilder;
+using grpc::ServerContext;
+using grpc::ServerReader;
+using grpc::ServerReaderWriter;
+using grpc::ServerWriter;
+using grpc::Status;
+
+using namespace std; 
+
+// Exit the process with a message in the event of a fatal error
+void killSession(string error) 
+{
+	logger().flush();
+	cerr << "\nMASTER ERROR: " << error << " (errno " << errno << ")" << endl;
+	cerr << "Master encountered unrecoverable error" << endl;
+	cerr << "Server shutting down..." << endl;
+	exit(EXIT_FAILURE);
+}
+
+// RPC handling time per method (for Timeline, per message read from the stream)
+LatencyMetric login_latency("tsns_rpc_duration_seconds", "Time spent handling an RPC (Timeline: per stream message)", "method=\"Login\"");
+LatencyMetric list_latency("tsns_rpc_duration_seconds", "", "method=\"List\"");
+LatencyMetric follow_latency("tsns_rpc_duration_seconds", "", "method=\"Follow\"");
+LatencyMetric unfollow_latency("tsns_rpc_duration_seconds", "", "method=\"Unfollow\"");
+LatencyMetric timeline_latency("tsns_rpc_duration_seconds", "", "method=\"Timeline\"");
+LatencyMetric get_timeline_latency("tsns_rpc_duration_seconds", "", "method=\"GetTimeline\"");
+Gauge open_streams("tsns_timeline_streams", "Timeline streams currently open");
+Gauge present_users("tsns_present_users", "Users in the presence index (with an open timeline stream)");
+
+// Admission control metrics
+Counter posts_limited("tsns_rate_limited_total", "Requests rejected by a per-user rate limit", "kind=\"post\"");
+Counter graph_limited("tsns_rate_limited_total", "", "kind=\"graph\"");
+Counter overload_shed("tsns_overload_shed_total", "Requests rejected because the in-flight budget was exhausted");
+Counter streams_shed("tsns_streams_shed_total", "Timeline streams rejected because the stream limit was reached");
+
+// Open timeline streams allowed at once (each holds a server thread for as long as it is open)
+InflightBudget stream_budget;
+
+// Changes to the registry and follower graph, followed by the slave when it runs as a read replica
+MutationLog mutation_log;
+
+// Every RPC handled, when capturing traffic for tsreplay ('-C'), and the id of the next captured Timeline stream
+CaptureWriter capture;
+atomic<uint64_t> next_capture_stream(1);
+
+// Trims the feeds to the retention policy ('-K'/'-A') and moves older posts to the cold tier ('-T'), if asked to
+Compactor compactor;
+
+// Retention and cold tier metrics, declared in compaction.h
+Counter compaction_feeds("tsns_compaction_feeds_total", "Feeds trimmed by retention");
+Counter compaction_posts("tsns_compaction_posts_dropped_total", "Posts dropped by retention");
+Counter compaction_io("tsns_compaction_io_bytes_total", "Bytes read and written by compaction");
+Counter compaction_reclaimed("tsns_compaction_reclaimed_bytes_total", "Bytes of feeds and indexes freed by retention");
+Counter cold_posts("tsns_cold_posts_total", "Posts moved to the cold tier");
+Counter cold_raw_bytes("tsns_cold_raw_bytes_total", "Bytes of posts moved to the cold tier, before compression");
+Counter cold_compressed_bytes("tsns_cold_compressed_bytes_total", "Bytes of posts moved to the cold tier, after compression");
+
+// Retry hint given with requests shed because the server is at its in-flight budget
+#define OVERLOAD_RETRY_MS 50
+
+// Threads of the client server waiting for new calls, on top of those handling calls
+#define SYNC_POLLERS 2
+
+// Router metrics, declared in router.h
+Counter router_redirects("tsns_router_redirects_total", "Clients directed to an available master");
+Counter router_unavailable("tsns_router_no_master_total", "Clients turned away because no master was available");
+Counter router_removed("tsns_router_masters_removed_total", "Masters removed from the pool after a DEAD report");
+Gauge router_pool("tsns_router_pool_size", "Masters available to receive clients");
+Counter router_evicted("tsns_router_masters_evicted_total", "Masters taken out of rotation after failing health probes");
+Counter router_restored("tsns_router_masters_restored_total", "Masters put back into rotation after passing health probes again");
+Counter router_synced("tsns_router_masters_synced_total", "Masters learned from a peer router's table");
+Counter router_syncs_sent("tsns_router_syncs_sent_total", "Tables sent to peer routers");
+Gauge router_replicas("tsns_router_replicas", "Read replicas known for the masters in the table");
+
+// Router health probe metrics, declared in health.h
+LatencyMetric health_probe_rtt("tsns_health_probe_seconds", "Round trip time of successful health probes of masters");
+Counter health_probe_failures("tsns_health_probe_failures_total", "Health probes of masters that failed or timed out");
+
+// Heartbeat and failover metrics (master and router)
+LatencyMetric heartbeat_rtt("tsns_heartbeat_rtt_seconds", "Round trip time of heartbeats with the peer process");
+Counter peer_restarts("tsns_failovers_total", "Times the peer process was declared dead and restarted");
+
+// Reply to a request that was not admitted, with the retry hint in the message and the "retry-after-ms" trailer
+Status resourceExhausted(ServerContext *context, const string &reason, int64_t retry_after_ns)
+{
+	string retry_after_ms = to_string(retry_after_ns / 1000000 + 1);
+	context->AddTrailingMetadata("retry-after-ms", retry_after_ms);
+	return Status(grpc::StatusCode::RESOURCE_EXHAUSTED, reason + ", retry after " + retry_after_ms + " ms");
+}
+
+// Reply to a request shed because the in-flight budget is exhausted
+Status overloaded(ServerContext *context)
+{
+	overload_shed.add();
+	return resourceExhausted(context, "Server overloaded", OVERLOAD_RETRY_MS * 1000000LL);
+}
+
+// Take a follow/unfollow token of the given user (if registered)
+// Returns false with the time until the next token if the user is over the limit
+bool admitGraphChange(const string &username, int64_t &retry_after_ns)
+{
+	int user_index = find_user(username);
+	if (user_index < 0 || client_db[user_index].graph_bucket.admit(graph_limit, monotonicNanos(), retry_after_ns))
+		return true;
+	graph_limited.add();
+	return false;
+}
+
+class SNSServiceImpl final : public SNSService::Service
+{
+
+	Status List(ServerContext *context, const Request *request, ListReply *list_reply) override
+	{
+		ScopedTimer timer(list_latency);
+		CaptureScope captured(capture, CAPTURE_LIST, 0, *request);
+		InflightGuard guard(inflight_budget);
+		if (!guard.admitted)
+			return overloaded(context);
+		int user_index = find_user(request->username());
+		if (user_index < 0)
+			return Status(grpc::StatusCode::NOT_FOUND, "Username \"" + request->username() + "\" not registered");
+		buildListReply(client_db[user_index], list_reply);
+		return Status::OK;
+	}
+
+	Status Follow(ServerContext *context, const Request *request, Reply *reply) override
+	{
+		ScopedTimer timer(follow_latency);
+		CaptureScope captured(capture, CAPTURE_FOLLOW, 0, *request);
+		InflightGuard guard(inflight_budget);
+		if (!guard.admitted)
+			return overloaded(context);
+		string username1 = request->username();
+		string username2 = request->arguments(0);
+		int64_t retry_after_ns;
+		if (!admitGraphChange(username1, retry_after_ns))
+			return resourceExhausted(context, "Follow rate limit exceeded", retry_after_ns);
+		if (find_user(username1) < 0)
+			return Status(grpc::StatusCode::NOT_FOUND, "Username \"" + username1 + "\" not registered");
+		int join_index = find_user(username2);
+		if (join_index < 0 || username1 == username2)
+			reply->set_msg("Follow Failed -- Invalid Username");
+		else
+		{
+			Client *user1 = &client_db[find_user(username1)];
+			Client *user2 = &client_db[join_index];
+			if (!followUser(user1, user2))
+			{
+				reply->set_msg("Follow Failed -- Already Following User");
+				return Status::OK;
+			}
+			mutation_log.append("FOLLOW " + username1 + " " + username2);
+			reply->set_msg("Follow Successful");
+		}
+		return Status::OK;
+	}
+
+	Status Unfollow(ServerContext *context, const Request *request, Reply *reply) override
+	{
+		ScopedTimer timer(unfollow_latency);
+		CaptureScope captured(capture, CAPTURE_UNFOLLOW, 0, *request);
+		InflightGuard guard(inflight_budget);
+		if (!guard.admitted)
+			return overloaded(context);
+		string username1 = request->username();
+		string username2 = request->arguments(0);
+		int64_t retry_after_ns;
+		if (!admitGraphChange(username1, retry_after_ns))
+			return resourceExhausted(context, "Unfollow rate limit exceeded", retry_after_ns);
+		if (find_user(username1) < 0)
+			return Status(grpc::StatusCode::NOT_FOUND, "Username \"" + username1 + "\" not registered");
+		int leave_index = find_user(username2);
+		if (leave_index < 0 || username1 == username2)
+			reply->set_msg("Unfollow Failed -- Invalid Username");
+		else
+		{
+			Client *user1 = &client_db[find_user(username1)];
+			Client *user2 = &client_db[leave_index];
+			if (!unfollowUser(user1, user2))
+			{
+				reply->set_msg("Unfollow Failed -- Not Following User");
+				return Status::OK;
+			}
+			mutation_log.append("UNFOLLOW " + username1 + " " + username2);
+			reply->set_msg("Unfollow Successful");
+		}
+		return Status::OK;
+	}
+
+	Status Login(ServerContext *context, const Request *request, Reply *reply) override
+	{
+		ScopedTimer timer(login_latency);
+		CaptureScope captured(capture, CAPTURE_LOGIN, 0, *request);
+		InflightGuard guard(inflight_budget);
+		if (!guard.admitted)
+			return overloaded(context);
+		Client c;
+		string username = request->username();
+		int user_index = find_user(username);
+		if (user_index < 0)
+		{
+			c.username = username;
+			client_db.push_back(c);
+			mutation_log.append("REGISTER " + username);
+			reply->set_msg("Login Successful!");
+		}
+		else
+		{
+			Client *user = &client_db[user_index];
+			if (user->connected)
+				reply->set_msg("Invalid Username");
+			else
+			{
+				string msg = "Welcome Back " + user->username;
+				reply->set_msg(msg);
+				user->connected = true;
+			}
+		}
+		return Status::OK;
+	}
+
+	Status GetTimeline(ServerContext *context, const TimelineRequest *request, TimelinePage *page) override
+	{
+		ScopedTimer timer(get_timeline_latency);
+		CaptureScope captured(capture, CAPTURE_GET_TIMELINE, 0, *request);
+		InflightGuard guard(inflight_budget);
+		if (!guard.admitted)
+			return overloaded(context);
+		int user_index = find_user(request->username());
+		if (user_index < 0)
+			return Status(grpc::StatusCode::NOT_FOUND, "Username \"" + request->username() + "\" not registered");
+		buildTimelinePage(client_db[user_index], *request, page);
+		return Status::OK;
+	}
+
+	Status Timeline(ServerContext *context,
+					ServerReaderWriter<Message, Message> *stream) override
+	{
+		// Streams beyond the limit are turned away, leaving the other threads to unary calls
+		InflightGuard stream_guard(stream_budget);
+		if (!stream_guard.admitted)
+		{
+			streams_shed.add();
+			LOG_EVERY_MS(LOG_WARN, 1000, "stream_shed");
+			return resourceExhausted(context, "Too many timeline streams", OVERLOAD_RETRY_MS * 1000000LL);
+		}
+
+		Message message;
+		Client *c = 0;
+		shared_ptr<LiveStream> session = make_shared<LiveStream>(stream);
+		open_streams.add(1);
+		uint64_t capture_stream = capture.enabled() ? next_capture_stream++ : 0;
+		while (stream->Read(&message))
+		{
+			ScopedTimer timer(timeline_latency);
+			CaptureScope captured(capture, CAPTURE_STREAM_MESSAGE, capture_stream, message);
+			string username = message.username();
+			int user_index = find_user(username);
+			if (user_index > -1)
+			{
+				LOG_EVERY_MS(LOG_DEBUG, 1000, "stream_message", "user=%s index=%d users=%zu", username.c_str(), user_index, client_db.size());
+				c = &client_db[user_index];
+			}
+			else 
+			{
+				LOG(LOG_ERROR, "stream_user_unknown", "user=%s", username.c_str());
+				string ret_msg = "Username \"" + username + "\" not registered!";
+				killSession(ret_msg);		
+			}
+
+			//The first message of a stream registers it and replays the newest 20 posts from the people you follow
+			//(a client that already has the posts up to some post id, from its cache or from the process this
+			//one took over from, only gets the ones after it)
+			//(the stream is registered before the feed is read, so a post appended after the read is delivered
+			//live; live posts wait for the replay, and the client drops any the replay already had)
+			if (message.open_stream())
+			{
+				uint64_t since_post_id = message.post_id();
+				session->replay([&](vector<Message> &replayed)
+				{
+					presence.enter(c, session);
+					vector<Message> newest_twenty;
+					readNewestPosts(c, newest_twenty);
+					//(a client claiming posts the feed does not have yet cached them before the feed was started over)
+					if (!newest_twenty.empty() && newest_twenty.back().post_id() < since_post_id)
+						since_post_id = 0;
+					for (unsigned i = 0; i < newest_twenty.size(); i++)
+						if (newest_twenty[i].post_id() > since_post_id)
+							replayed.push_back(newest_twenty[i]);
+				});
+				present_users.set(presence.size());
+				continue;
+			}
+
+			//Turn the post away if the server is at its in-flight budget or the user is posting too fast
+			//(before the dedup check, so the post is not marked as seen), telling the client when to resend it
+			InflightGuard guard(inflight_budget);
+			int64_t retry_after_ns = OVERLOAD_RETRY_MS * 1000000LL;
+			bool admitted = guard.admitted;
+			if (!admitted)
+			{
+				overload_shed.add();
+				LOG_EVERY_MS(LOG_WARN, 1000, "post_shed", "user=%s", username.c_str());
+			}
+			else if (!(admitted = c->post_bucket.admit(post_limit, monotonicNanos(), retry_after_ns)))
+			{
+				posts_limited.add();
+				LOG_EVERY_MS(LOG_INFO, 1000, "post_rate_limited", "user=%s retry_after_ms=%lld", username.c_str(),
+					(long long) retry_after_ns / 1000000);
+			}
+			if (!admitted)
+			{
+				Message retry;
+				retry.set_seq(message.seq());
+				retry.set_retry_after_ms(retry_after_ns / 1000000 + 1);
+				session->write(retry);
+				continue;
+			}
+
+			//Drop retransmitted posts that were already written, but acknowledge them again so the client stops retrying
+			//(a post older than the dedup window may never have been written, so it is not acknowledged: the client
+			//resends it with a new seq)
+			SequenceCheck check = acceptSequence(c, message.seq());
+			if (check == SEQ_DUPLICATE)
+			{
+				LOG_EVERY_MS(LOG_DEBUG, 1000, "duplicate_post", "user=%s seq=%llu", username.c_str(), (unsigned long long) message.seq());
+				Message ack;
+				ack.set_ack(message.seq());
+				session->write(ack);
+				continue;
+			}
+			if (check == SEQ_TOO_OLD)
+			{
+				LOG_EVERY_MS(LOG_WARN, 1000, "post_resync", "user=%s seq=%llu seq_high=%llu", username.c_str(),
+					(unsigned long long) message.seq(), (unsigned long long) c->seq_high);
+				Message resync;
+				resync.set_seq(message.seq());
+				resync.set_resync_seq(c->seq_high);
+				session->write(resync);
+				continue;
+			}
+
+			//Encode the post once, the same record is appended to every feed it belongs to
+			string record = encodePost(message);
+			appendRecord(userFeedPath(username), record);
+			disk_bytes_written.add(record.size());
+
+			//Send the message to each follower's stream
+			fanOutPost(c, message, record);
+
+			//Let the poster know the post is stored so it can be dropped from its retry queue
+			if (message.seq() != 0)
+			{
+				Message ack;
+				ack.set_ack(message.seq());
+				session->write(ack);
+			}
+		}
+		//If the client disconnected from Chat Mode, take it out of the presence index and set connected to false
+		//(closing the session first, so no fan-out writes to the stream after the handler returns)
+		session->close();
+		open_streams.add(-1);
+		if (capture.enabled())
+			capture.record(CAPTURE_STREAM_END, capture_stream, capture.now(), 0, NULL);
+		if (c != 0)
+		{
+			presence.leave(c, session);
+			present_users.set(presence.size());
+			c->connected = false;
+		}
+		return Status::OK;
+	}
+};
+
+// Function to register master server with router by sending the message 'MASTER <client port>'
+void registerMaster(const char* router_addr, string backend_port, string client_port)
+{
+	int sock;
+	struct sockaddr_in addr;
+	string register_msg = "MASTER " + client_port;
+
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(stoi(backend_port));
+
+	if((sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
+		killSession("Socket error in registerMaster()");
+	
+	// Convert router address from text to binary form and store in the struct
+    if(inet_pton(AF_INET, router_addr, &addr.sin_addr) <= 0)  
+		killSession("Invalid router address in registerMaster()");
+
+	// Connect to the router 
+	if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) 
+		killSession("connect() to router failed in registerMaster()");
+	
+	// Send message 'MASTER' to router
+	send(sock, register_msg.c_str(), register_msg.size(), 0);
+	close(sock);
+
+	LOG(LOG_INFO, "registered_with_router", "router=%s client_port=%s", router_addr, client_port.c_str());
+}
+
+// Report ready to the supervisor once both the heartbeat listener and the router/client server are up
+void readyPart()
+{
+	static atomic<int> parts(0);
+	if (++parts == 2)
+		notifyReady();
+}
+
+// Hot restart: the heartbeat sockets taken over from the process being replaced, and the connection
+// to tell it once this process serves clients
+int inherited_h_sock = -1, inherited_slave = -1;
+int handoff_conn = -1;
+
+// Hot restart: set when handing over to a new process, the heartbeat thread then stops and leaves its sockets here
+atomic<bool> handing_off(false);
+atomic<int> parked_h_sock(-1), parked_slave(-1);
+
+// The client server, shut down by a hot restart
+Server *client_server = NULL;
+
+// Function to maintain heartbeat message with slave server
+void heartbeat(const char* router_addr, string client_port, string backend_port, string heartbeat_port, string peers, string replica_port) 
+{
+	int h_sock, b_sock, slave;
+	struct sockaddr_in h_addr, b_addr;
+	int addr_len = sizeof(h_addr);
+	string heartbeat_msg = "ALIVE " + to_string(getpid());	// Tells the peer which process to supervise
+	const char* dead_msg = "DEAD";
+	char buf[1024] = {0};
+
+	h_addr.sin_family = b_addr.sin_family = AF_INET;
+	h_addr.sin_addr.s_addr = INADDR_ANY;
+	h_addr.sin_port = htons(stoi(heartbeat_port));
+	b_addr.sin_port = htons(stoi(backend_port));
+
+	if((h_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0 || (b_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
+		killSession("Socket error in heartbeat()");
+
+	int opt = 1;
+	if((setsockopt(h_sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &opt, sizeof(opt))) < 0)
+		killSession("setsockopt() failed in heartbeat()");
+    
+	LOG(LOG_DEBUG, "heartbeat_start", "router=%s heartbeat_port=%s", router_addr, heartbeat_port.c_str());
+
+	// Convert router address from text to binary form and store in the struct
+    if(inet_pton(AF_INET, router_addr, &b_addr.sin_addr) <= 0)  
+		killSession("Invalid router address in heartbeat()");
+
+	// In a hot restart the process being replaced hands over its listener and its connection to the slave
+	if (inherited_h_sock >= 0)
+	{
+		h_sock = inherited_h_sock;
+		slave = inherited_slave;
+		readyPart();
+		cout << "Master took over the heartbeat with the slave" << endl;
+	}
+	else
+	{
+		// Retry for a few seconds, in router mode route() may not be listening yet
+		cout << "Master connecting to router... ";
+		int attempts = 0;
+		while (connect(b_sock, (struct sockaddr *)&b_addr, sizeof(b_addr)) < 0) 
+		{
+			if (++attempts == 50)
+				killSession("connect() to router failed in heartbeat()");
+			usleep(100000);
+		}
+		cout << "connected!" << endl;
+	
+		// Start listening for heartbeats from slave
+		if(bind(h_sock, (struct sockaddr*) &h_addr, sizeof(h_addr)) < 0)
+			killSession("bind() failed in heartbeat()");
+
+		if (listen(h_sock, 1) < 0) 
+			killSession("listen() failed in heartbeat()");
+		readyPart();
+
+		cout << "Master accepting connection from slave... ";
+	    if ((slave = accept(h_sock, (struct sockaddr *)&h_addr, (socklen_t*)&addr_len)) < 0) 
+			killSession("accept() failed in heartbeat()");
+		cout << "accepted!" << endl;
+	}
+
+	// Supervise exactly the slave on the other end, restarting it with the same arguments
+	// (a router's slave is told the peer routers, to restart the router with them)
+	vector<string> args = {"./tsds", "-h", heartbeat_port, "-c", client_port, "-b", backend_port, "-a", router_addr};
+	if (!peers.empty())
+	{
+		args.push_back("-p");
+		args.push_back(peers);
+	}
+	if (!replica_port.empty())
+	{
+		args.push_back("-R");
+		args.push_back(replica_port);
+	}
+	Supervisor slave_process(args);
+
+	// Set timeout on heartbeat reads to 5 seconds
+	// This is the inactivity threshold for rebooting the slave
+	struct timeval tv;
+	tv.tv_sec = 5;
+	tv.tv_usec = 0;
+	if((setsockopt(slave, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv))) < 0)
+		killSession("setsockopt() failed in heartbeat()");
+	
+	cout << "Master initialization complete, beginning keepalive." << endl;
+	int status;
+	while (true)
+	{
+		// Send heartbeat to slave
+		chrono::steady_clock::time_point sent = chrono::steady_clock::now();
+    	send(slave, heartbeat_msg.c_str(), heartbeat_msg.size(), MSG_NOSIGNAL); 
+
+		// Attempt to read heartbeat from slave
+    	status = read(slave, buf, 1024); 
+		if (status > 0)
+		{
+			heartbeat_rtt.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - sent).count());
+			// A peer started from outside is adopted from its first heartbeat
+			if (slave_process.current() == 0)
+				slave_process.adopt(heartbeatPid(buf, status));
+		}
+		else
+		{
+			peer_restarts.add();
+			LOG(LOG_WARN, "slave_heartbeat_lost", "pid=%d", (int) slave_process.current());
+			
+			// Let every client log in again (their open streams stay in the presence index until they close)
+			for (Client &client : client_db)
+				client.connected = false;
+
+			// Send message informing router of the slaves death
+			// send(b_sock, dead_msg, strlen(dead_msg), 0);	
+
+			// Close if still running (only our own slave, others may run on this host), restart it
+			// and wait for it to be ready (connected to us), backing off if it keeps failing
+			slave_process.stop();
+			close(slave);
+			LOG(LOG_INFO, "slave_restart");
+			int64_t restart_start = monotonicNanos();
+			if (!slave_process.restart())
+				killSession("Slave failed to start in heartbeat()");
+			cout << "Restarted slave (pid " << slave_process.current() << "), ready after " << (monotonicNanos() - restart_start) / 1000000 << " ms" << endl;
+
+			// Accept the slave's connection
+			if ((slave = accept(h_sock, (struct sockaddr *)&h_addr, (socklen_t*)&addr_len)) < 0) 
+				killSession("accept() failed in heartbeat()");
+			cout << "Accepted slave reconnection" << endl;
+
+			if((setsockopt(slave, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv))) < 0)
+				killSession("setsockopt() failed in heartbeat()");
+
+			LOG(LOG_DEBUG, "slave_reconnected", "pid=%d", (int) slave_process.current());
+			
+			// Re-register with router (a router does not register with itself)
+			if (string(router_addr) != "127.0.0.1")
+				registerMaster(router_addr, backend_port, client_port);
+			continue;
+		}
+
+		// Don't flood slave with heartbeat messages, but go straight to the restart if it exits meanwhile
+		slave_process.waitForExit(1000);
+
+		// Leave the heartbeat to the process taking over in a hot restart
+		if (handing_off)
+		{
+			parked_h_sock = h_sock;
+			parked_slave = slave;
+			return;
+		}
+	}
+}
+
+// Parse the port following the command word of a router message (e.g. "MASTER 3010"), 0 if none is given
+int parsePort(const char* buf, int len)
+{
+	string msg(buf, len);
+	size_t index = msg.find_first_of(" ");
+	if (index == string::npos)
+		return 0;
+	return atoi(msg.c_str() + index + 1);
+}
+
+// Function to route clients to available registered master servers and manage available masters
+// Registered masters are health checked every probe_ms and taken out of rotation after probe_failures failed probes
+// The table is replicated to the peer routers (backend "ip:port"s), and theirs merged into it
+void route(string client_port, string backend_port, int probe_ms, int probe_failures, vector<RouterPeer> peers) 
+{
+	// Registered masters in order of preference
+	RoutingTable table(probe_ms, probe_failures);
+	int64_t next_sync = 0;
+	vector<int> servers;
+	vector<struct sockaddr_in> server_addrs;
+	vector<string> partial;	// Incomplete peer lines per connection
+	char buf[4096];
+
+	int b_sock, c_sock;
+	struct sockaddr_in b_addr, c_addr;
+	int addr_len = sizeof(b_addr);
+
+	c_addr.sin_family = b_addr.sin_family = AF_INET;
+	c_addr.sin_addr.s_addr = b_addr.sin_addr.s_addr = INADDR_ANY;
+	c_addr.sin_port = htons(stoi(client_port));
+	b_addr.sin_port = htons(stoi(backend_port));
+
+	// Create server socket on client and backend ports
+	if((b_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0 || (c_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
+		killSession("Socket error in route()");
+	
+	int opt = 1;
+	if((setsockopt(b_sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &opt, sizeof(opt))) < 0)
+		killSession("setsockopt() failed in route()");
+
+	if((setsockopt(c_sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &opt, sizeof(opt))) < 0)
+		killSession("setsockopt() failed in route()");
+
+	if((bind(b_sock, (struct sockaddr*) &b_addr, sizeof(b_addr)) < 0) || (bind(c_sock, (struct sockaddr*) &c_addr, sizeof(c_addr)) < 0))
+		killSession("Could not successfully bind sockets in route()");
+
+	// Listen for connection requests on backend (for masters/slaves/peer routers) and client (for clients) ports
+	if ((listen(b_sock, 128) < 0) || (listen(c_sock, 128) < 0)) 
+		killSession("listen() failed in route()");
+	readyPart();
+	
+	fd_set readfds;
+	while(true)
+	{
+		int maxfd = max(b_sock, c_sock);
+		FD_ZERO(&readfds);
+		FD_SET(b_sock, &readfds);
+		FD_SET(c_sock, &readfds);
+
+		for (auto sock : servers) 
+		{
+			if (sock > maxfd) maxfd = sock;
+			FD_SET(sock, &readfds);
+		}
+
+		// Wake up in time to send the next health probes and table sync
+		struct timeval timeout;
+		int64_t wait_ns = table.untilNextPoll();
+		if (!peers.empty())
+			wait_ns = max((int64_t) 0, min(wait_ns, next_sync - monotonicNanos()));
+		timeout.tv_sec = wait_ns / 1000000000;
+		timeout.tv_usec = (wait_ns % 1000000000) / 1000;
+		if (select(maxfd + 1, &readfds, NULL, NULL, &timeout) < 0) 
+            killSession("select failed in route()");
+
+		// Take masters that stopped answering health probes out of rotation, and put recovered ones back
+		table.poll();
+
+		// Send the table to the peer routers
+		if (!peers.empty() && monotonicNanos() >= next_sync)
+		{
+			string sync = table.syncMessage();
+			for (RouterPeer &peer : peers)
+				if (sendToPeer(peer, sync))
+					router_syncs_sent.add();
+			next_sync = monotonicNanos() + SYNC_INTERVAL_MS * 1000000LL;
+		}
+
+		// Accept connection requests from masters/slaves/peer routers
+		if (FD_ISSET(b_sock, &readfds)) 
+		{
+			int temp = accept(b_sock, (struct sockaddr*)&b_addr, (socklen_t*)&addr_len);
+			if (temp < 0) 
+				killSession("accept() failed in route()");
+			else
+			{
+				// Listen for future communication from newly connected server
+				servers.push_back(temp);
+				server_addrs.push_back(b_addr);
+				partial.push_back("");
+			}
+		}
+
+		// Check among connected servers for new messages
+		for(unsigned i = 0; i < servers.size(); i++)
+		{
+			if (FD_ISSET(servers[i], &readfds)) 
+			{
+				// Read the new message
+				int status = read(servers[i], buf, sizeof(buf)); 
+				if (status < 0)
+					killSession("read() failed in route()");
+				else if (status == 0) // Disconnection
+				{
+					close(servers[i]);
+					servers.erase(servers.begin() + i);
+					server_addrs.erase(server_addrs.begin() + i);
+					partial.erase(partial.begin() + i);
+					i--;
+					continue;
+				}
+				else if (buf[0] == 'M') // Register master
+				{
+					// Add ipv4 of servers[i] and its client port to the bottom of the hierarchy of available masters
+					// (a master already registered there is just put back into rotation)
+					struct sockaddr_in master = server_addrs.at(i);
+					master.sin_port = htons(parsePort(buf, status));
+					table.add(master);
+					next_sync = 0;
+					LOG(LOG_INFO, "master_registered", "master=%s", formatEndpoint(master).c_str());
+				}
+				else if (buf[0] == 'R') // Register the read replica of a master ('REPLICA <client port> <replica port>')
+				{
+					struct sockaddr_in master = server_addrs.at(i);
+					string words(buf, status), command, master_port, replica_port;
+					stringstream(words) >> command >> master_port >> replica_port;
+					master.sin_port = htons(atoi(master_port.c_str()));
+					if (master.sin_port != 0 && atoi(replica_port.c_str()) > 0)
+					{
+						table.setReplica(master, atoi(replica_port.c_str()));
+						next_sync = 0;
+					}
+					LOG(LOG_INFO, "replica_registered", "master=%s replica_port=%s", formatEndpoint(master).c_str(), replica_port.c_str());
+				}
+				else if (buf[0] == 'D') // Reporting dead master/slave
+				{
+					// Remove server from the hierarchy of available masters
+					// (only the one on the reported client port, if the slave named one), and tell the peers
+					vector<string> removed = table.remove(server_addrs.at(i).sin_addr.s_addr, htons(parsePort(buf, status)));
+					if (!removed.empty())
+					{
+						string forget = "FORGET";
+						for (const string &endpoint : removed)
+							forget += " " + endpoint;
+						forget += "\n";
+						for (RouterPeer &peer : peers)
+							sendToPeer(peer, forget);
+					}
+					LOG(LOG_INFO, "masters_removed", "count=%zu", removed.size());
+				} 
+				else if (buf[0] == 'S' || buf[0] == 'F' || !partial[i].empty()) // Peer router's table or removals
+				{
+					// Peers send newline terminated lines that may arrive split or coalesced
+					partial[i].append(buf, status);
+					size_t newline;
+					while ((newline = partial[i].find('\n')) != string::npos)
+					{
+						if (table.applyPeerMessage(partial[i].substr(0, newline)))
+							next_sync = 0;
+						partial[i].erase(0, newline + 1);
+					}
+				}
+				else
+				{
+					LOG(LOG_WARN, "unknown_router_request", "request=\"%.*s\"", min(status, 64), buf);
+				}
+			}
+		}
+
+		// If a new client connects
+		if (FD_ISSET(c_sock, &readfds)) 
+		{
+			// Accept the client connection
+			int temp = accept(c_sock, (struct sockaddr*)&c_addr, (socklen_t*)&addr_len);
+			if (temp < 0) 
+				killSession("accept() failed in route()");
+			
+			// Pick the first master in rotation
+			const RegisteredMaster *available = table.pick();
+
+			// If there are masters available
+			if (available != NULL)
+			{
+				char ip[INET_ADDRSTRLEN];
+
+				// Convert the available master's address to string format
+				if (inet_ntop(AF_INET, &available->addr.sin_addr, ip, INET_ADDRSTRLEN) == NULL)
+					killSession("Failed to convert address to string in route()");
+
+				// Send the client the address of the available master, as "ip:port" if the port is known,
+				// followed by its read replica's "ip:port" (after the terminator, where clients that only
+				// want the master do not look)
+				string reply(ip);
+				if (available->addr.sin_port != 0)
+					reply += ":" + to_string(ntohs(available->addr.sin_port));
+				reply.push_back('\0');
+				string replica = table.replicaOf(*available);
+				if (!replica.empty())
+				{
+					reply += replica;
+					reply.push_back('\0');
+				}
+				send(temp, reply.data(), reply.size(), MSG_NOSIGNAL);
+				router_redirects.add();
+				LOG_EVERY_MS(LOG_DEBUG, 1000, "client_redirected");
+			}
+			// If there are no available masters, send a single byte
+			else 
+			{
+				send(temp, "0", 1, MSG_NOSIGNAL);
+				router_unavailable.add();
+				LOG_EVERY_MS(LOG_WARN, 1000, "no_master_available");
+			}
+
+			// Close the client connection
+			close(temp);	
+		}
+	}
+}
+
+// Hand this master over to a new process started with -H, whenever one asks (see handoff.h)
+void handoffServer(string client_port, int drain_ms)
+{
+	struct sockaddr_un addr;
+	socklen_t addr_len = handoffAddress(client_port, addr);
+	int listener, conn;
+	if ((listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+		killSession("Socket error in handoffServer()");
+
+	// The process this one took over from gives up the name as soon as it has accepted us
+	int attempts = 0;
+	while (bind(listener, (struct sockaddr *) &addr, addr_len) < 0)
+	{
+		if (++attempts == 50)
+		{
+			cerr << "Hot restart unavailable, another process holds the handoff socket of port " << client_port << endl;
+			close(listener);
+			return;
+		}
+		usleep(100000);
+	}
+	if (listen(listener, 1) < 0)
+		killSession("listen() failed in handoffServer()");
+
+	char buf[16] = {0};
+	while (true)
+	{
+		if ((conn = accept4(listener, NULL, NULL, SOCK_CLOEXEC)) < 0)
+			killSession("accept() failed in handoffServer()");
+		if (recv(conn, buf, sizeof(buf), 0) == 7 && strncmp(buf, "HANDOFF", 7) == 0)
+			break;
+		close(conn);
+	}
+	close(listener);
+	cout << "Handing over to a new process..." << endl;
+
+	// The new process trims the feeds from now on (once this one has drained)
+	compactor.stop();
+
+	// Stop the heartbeat between two beats and take its sockets
+	handing_off = true;
+	while (parked_slave < 0)
+		usleep(1000);
+
+	csce438::Snapshot snapshot;
+	buildSnapshot(&snapshot);
+	string payload;
+	snapshot.SerializeToString(&payload);
+	if (!sendWithFds(conn, "FDS", {parked_h_sock, parked_slave}) || !sendFrame(conn, payload)
+			|| recv(conn, buf, sizeof(buf), MSG_WAITALL) != 5 || strncmp(buf, "READY", 5) != 0)
+	{
+		// Without a heartbeat the slave restarts a master from scratch
+		cerr << "Hot restart failed, leaving the restart to the slave" << endl;
+		close(conn);
+		return;
+	}
+	close(conn);
+	cout << "New process serving clients, draining " << drain_ms << " ms" << endl;
+
+	// Stop accepting connections (the new process gets them all from now on) and let open calls finish
+	thread shutdown([drain_ms]()
+	{
+		client_server->Shutdown(chrono::system_clock::now() + chrono::milliseconds(drain_ms));
+	});
+
+	// Ask open streams to move over a few at a time, over half the drain time, rather than all at once
+	// (starting one interval in, once clients have been told to stop opening calls here)
+	vector<shared_ptr<LiveStream>> streams;
+	presence.all(streams);
+	Message reopen;
+	reopen.set_reopen(true);
+	for (size_t i = 0; i < streams.size(); i++)
+	{
+		usleep(drain_ms * 500 / streams.size());
+		streams[i]->write(reopen);
+	}
+	shutdown.join();
+}
+
+// Take over from the master serving clients on this port (hot restart): its heartbeat sockets and state
+void takeOver(string client_port)
+{
+	struct sockaddr_un addr;
+	socklen_t addr_len = handoffAddress(client_port, addr);
+	if ((handoff_conn = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+		killSession("Socket error in takeOver()");
+	if (connect(handoff_conn, (struct sockaddr *) &addr, addr_len) < 0)
+		killSession("No master on port " + client_port + " to take over from");
+	string request = "HANDOFF";
+	if (send(handoff_conn, request.c_str(), request.size(), MSG_NOSIGNAL) != (ssize_t) request.size())
+		killSession("send() failed in takeOver()");
+
+	char buf[3];
+	vector<int> fds;
+	string payload;
+	csce438::Snapshot snapshot;
+	if (recvWithFds(handoff_conn, buf, sizeof(buf), fds) != sizeof(buf) || fds.size() != 2
+			|| !recvFrame(handoff_conn, payload) || !snapshot.ParseFromString(payload))
+		killSession("Handoff from the running master failed in takeOver()");
+	inherited_h_sock = fds[0];
+	inherited_slave = fds[1];
+	restoreSnapshot(snapshot);
+	cout << "Took over " << snapshot.users_size() << " users from the running master" << endl;
+}
+
+// Run the gRPC client server
+// With a stream limit and unary_threads, the server's threads are capped at enough for the most streams
+// allowed plus unary_threads, so however many streams are open that many threads are left for unary calls
+void runServer(string client_port, int drain_ms, int max_streams, int unary_threads)
+{
+	string server_address = "0.0.0.0:" + client_port;
+	SNSServiceImpl service;
+
+	// Answer the router's grpc.health.v1 probes
+	grpc::EnableDefaultHealthCheckService(true);
+
+	ServerBuilder builder;
+	builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+	builder.RegisterService(&service);
+	// The process being replaced in a hot restart listens on the same port until it drains
+	builder.AddChannelArgument(GRPC_ARG_ALLOW_REUSEPORT, 1);
+	if (max_streams > 0 && unary_threads > 0)
+	{
+		grpc::ResourceQuota quota("tsdm");
+		quota.SetMaxThreads(max_streams + unary_threads + SYNC_POLLERS);
+		builder.SetResourceQuota(quota);
+		builder.SetSyncServerOption(ServerBuilder::SyncServerOption::NUM_CQS, 1);
+		builder.SetSyncServerOption(ServerBuilder::SyncServerOption::MIN_POLLERS, 1);
+		builder.SetSyncServerOption(ServerBuilder::SyncServerOption::MAX_POLLERS, SYNC_POLLERS);
+		cout << "Server threads: " << max_streams << " for streams, " << unary_threads << " for unary calls" << endl;
+	}
+	unique_ptr<Server> server(builder.BuildAndStart());
+	if (!server)
+		killSession("Could not listen for clients on " + server_address);
+	client_server = server.get();
+	readyPart();
+	cout << "Server listening for client requests on " << server_address << endl;
+
+	// Let the process being replaced drain, and be ready to be replaced in turn
+	if (handoff_conn >= 0)
+	{
+		send(handoff_conn, "READY", 5, MSG_NOSIGNAL);
+		close(handoff_conn);
+	}
+	thread(handoffServer, client_port, drain_ms).detach();
+
+	server->Wait();
+}
+
+int main(int argc, char **argv)
+{
+	string client_port = "3010";
+	string backend_port = "3059";
+	string heartbeat_port = "3076";
+	string router_address = "127.0.0.1";
+	string metrics_port = "";
+	string peers = "";
+	string replica_port = "";
+	double post_rate = 100, graph_rate = 10;
+	int max_inflight = 256;
+	int probe_ms = 100, probe_failures = 3;
+	bool hot_restart = false;
+	string storage_backend = "sync";
+	int drain_ms = DRAIN_MS;
+	string capture_path = "";
+	int max_streams = 0, unary_threads = 0;
+	int fanout_workers = 0;
+	string fanout_cpus = "";
+	string log_level = "";
+	RetentionPolicy retention;
+	TierPolicy tiering;
+	double compact_mbps = 8;
+
+	int opt = 0;
+
+	while ((opt = getopt(argc, argv, "c:h:b:a:m:r:g:i:t:f:p:HD:R:s:C:S:U:W:P:l:K:A:B:T:Z:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'c':
+			client_port = optarg;
+			break;
+		case 'h':
+			heartbeat_port = optarg;
+			break;
+		case 'b':
+			backend_port = optarg;
+			break;
+		case 'a':
+			router_address = optarg;
+			break;
+		case 'm':
+			metrics_port = optarg;
+			break;
+		case 'r':
+			post_rate = atof(optarg);
+			break;
+		case 'g':
+			graph_rate = atof(optarg);
+			break;
+		case 'i':
+			max_inflight = atoi(optarg);
+			break;
+		case 't':
+			probe_ms = max(1, atoi(optarg));
+			break;
+		case 'f':
+			probe_failures = max(1, atoi(optarg));
+			break;
+		case 'p':
+			peers = optarg;
+			break;
+		case 'H':
+			hot_restart = true;
+			break;
+		case 'D':
+			drain_ms = max(0, atoi(optarg));
+			break;
+		case 'R':
+			replica_port = optarg;
+			break;
+		case 's':
+			storage_backend = optarg;
+			break;
+		case 'C':
+			capture_path = optarg;
+			break;
+		case 'S':
+			max_streams = max(0, atoi(optarg));
+			break;
+		case 'U':
+			unary_threads = max(0, atoi(optarg));
+			break;
+		case 'W':
+			fanout_workers = max(0, atoi(optarg));
+			break;
+		case 'P':
+			fanout_cpus = optarg;
+			break;
+		case 'l':
+			log_level = optarg;
+			break;
+		case 'K':
+			retention.max_posts = max(0, atoi(optarg));
+			break;
+		case 'A':
+			retention.max_age_s = max(0, atoi(optarg));
+			break;
+		case 'B':
+			compact_mbps = max(0.0, atof(optarg));
+			break;
+		case 'T':
+			tiering.hot_posts = max(0, atoi(optarg));
+			break;
+		case 'Z':
+			tiering.level = atoi(optarg);
+			break;
+		default:
+			cerr << "Invalid Command Line Argument\n";
+			return -1;
+		}
+	}
+
+	// Cannot operate when ports collide
+	if (client_port == backend_port || client_port == heartbeat_port || heartbeat_port == backend_port)
+		killSession("Invalid port selection, conflicting ports");
+	if (!replica_port.empty() && router_address == "127.0.0.1")
+		killSession("Read replicas (-R) are only supported for masters");
+	if (!capture_path.empty() && router_address == "127.0.0.1")
+		killSession("Traffic capture (-C) is only supported for masters");
+
+	// Log at the given level (changed at runtime with SIGUSR1/SIGUSR2)
+	LogLevel level = (LogLevel) logger().level.load();
+	if (!log_level.empty() && !parseLogLevel(log_level, level))
+		killSession("Unknown log level \"" + log_level + "\", expected debug, info, warn, error or off");
+	logSetup(level);
+
+	// Per-user rates allow a burst of one second's worth of requests (0 disables a limit)
+	post_limit = RateLimit(post_rate, post_rate);
+	graph_limit = RateLimit(graph_rate, graph_rate);
+	inflight_budget.setLimit(max_inflight);
+	stream_budget.setLimit(max_streams);
+	if (unary_threads > 0 && max_streams == 0)
+		killSession("Unary threads (-U) need a stream limit (-S)");
+
+	// Deliver posts to open streams from fan-out workers, pinned to the given CPUs
+	vector<int> cpus;
+	if (!fanout_cpus.empty() && !parseCpuList(fanout_cpus, cpus))
+		killSession("Invalid CPU list \"" + fanout_cpus + "\", expected e.g. 0,2-3");
+	if (!cpus.empty() && fanout_workers == 0)
+		killSession("CPU pinning (-P) needs fan-out workers (-W)");
+	if (!fanout_pool.start(fanout_workers, cpus))
+		killSession("Could not pin fan-out workers to CPUs " + fanout_cpus);
+
+	// Storage backend for post fan-out (the sync path unless io_uring is asked for and available)
+	if (!selectFeedBackend(storage_backend))
+		killSession("Unknown storage backend \"" + storage_backend + "\", expected uring or sync");
+	if (router_address != "127.0.0.1")
+		cout << "Storage backend: " << feedBackend()->name() << endl;
+
+	// Record every RPC for tsreplay if requested
+	if (!capture_path.empty())
+	{
+		if (!capture.open(capture_path))
+			killSession("Could not open capture file " + capture_path);
+		cout << "Capturing traffic to " << capture_path << endl;
+	}
+
+	// Trim the feeds and move their older posts to the cold tier in the background if asked to (after the
+	// process being replaced has drained, in a hot restart)
+	if (tiering.level < Z_NO_COMPRESSION || tiering.level > Z_BEST_COMPRESSION)
+		killSession("Invalid compression level (-Z), expected 0 to 9");
+	if (retention.enabled() || tiering.enabled())
+	{
+		if (router_address == "127.0.0.1")
+			killSession("Retention (-K/-A) and the cold tier (-T) are only supported for masters");
+		compactor.start(retention, tiering, compact_mbps * 1024 * 1024, hot_restart ? drain_ms : 0);
+	}
+
+	// Serve metrics over HTTP if requested
+	if (metrics_port != "")
+		startMetricsServer(metrics_port);
+
+	// Take over the state and heartbeat of the master being replaced before serving anything
+	if (hot_restart)
+	{
+		if (router_address == "127.0.0.1")
+			killSession("Hot restart (-H) is only supported for masters");
+		takeOver(client_port);
+	}
+
+	// Start heartbeat thread to monitor slave
+	// (the slave is restarted as a read replica on replica_port if it runs as one)
+	thread monitor(heartbeat, router_address.c_str(), client_port, backend_port, heartbeat_port, peers, replica_port);
+
+	// If the server will operate as a router, route(), sharing its table with the peer routers ("ip:port" backend ports)
+	if (router_address == "127.0.0.1")
+	{
+		vector<RouterPeer> peer_routers;
+		stringstream list(peers);
+		string endpoint;
+		while (getline(list, endpoint, ','))
+		{
+			struct sockaddr_in addr;
+			if (!parseEndpoint(endpoint, addr))
+				killSession("Invalid peer router \"" + endpoint + "\", expected ip:port");
+			RouterPeer peer;
+			peer.endpoint = endpoint;
+			peer_routers.push_back(peer);
+		}
+		route(client_port, backend_port, probe_ms, probe_failures, peer_routers);
+	}
+	// Otherwise, register with router and run the client server
+	else
+	{
+		mutation_log.open(client_port, !hot_restart);
+		registerMaster(router_address.c_str(), backend_port, client_port);
+		runServer(client_port, drain_ms, max_streams, unary_threads);
+	}
+
+	monitor.join();
+	return 0;
+}
+
@@ -1,177 +1,334 @@
-#include <ctime>
-#include <cstring>
-#include <string>
-#include <fstream>
-#include <iostream>
-#include <thread>
-#include <stdlib.h>
-#include <unistd.h>
-#include <sys/wait.h>
-#include <netinet/in.h>
-#include <sys/socket.h>
-#include <arpa/inet.h>
-
-using namespace std;
-
-// Exit the process with a message in the event of a fatal error
-void killSession(string error) 
-{
-	cerr << "\nSLAVE ERROR: " << error << endl;
-	cerr << "errno: " << errno << endl;
-	cerr << "Slave encountered unrecoverable error!" << endl;
-	cerr << "Server shutting down..." << endl;
-	exit(EXIT_FAILURE);
-}
-
-// Function to reap slave process on termination to avoid creating a defunct process
-void reap(int signum) 
-{
-	wait(NULL);
-}
-
-// Function to maintain heartbeat message with slave server
-void heartbeat(const char* router_addr, string client_port, string backend_port, string heartbeat_port) 
-{
-	int h_sock, b_sock;
-	struct sockaddr_in h_addr, b_addr;
-	const char* heartbeat_msg = "ALIVE";
-	const char* dead_msg = "DEAD";
-	char buf[1024] = {0};
-
-	h_addr.sin_family = b_addr.sin_family = AF_INET;
-	h_addr.sin_addr.s_addr = INADDR_ANY;
-	h_addr.sin_port = htons(stoi(heartbeat_port));
-	b_addr.sin_port = htons(stoi(backend_port));
-
-	if((h_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0 || (b_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
-		killSession("Socket error in heartbeat()");
-
-	int opt = 1;
-	if((setsockopt(h_sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &opt, sizeof(opt))) < 0)
-		killSession("setsockopt() failed in heartbeat()");
-    
-	// Convert router address from text to binary form and store in the struct
-    if(inet_pton(AF_INET, router_addr, &b_addr.sin_addr) <= 0)  
-		killSession("Invalid router address in heartbeat()");
-
-	// Convert master address from text to binary form and store in the struct
-    if(inet_pton(AF_INET, "127.0.0.1", &h_addr.sin_addr) <= 0)  
-		killSession("Invalid master address in heartbeat()");
-
-	// Connect to the router 
-	cout << "Slave connecting to router... ";
-	if (connect(b_sock, (struct sockaddr *)&b_addr, sizeof(b_addr)) < 0) 
-		killSession("connect() to router failed in heartbeat()");
-	cout << "connected!" << endl;
-	
-	// Connect to the master 
-	cout << "Slave connecting to master... ";
-	if (connect(h_sock, (struct sockaddr *)&h_addr, sizeof(h_addr)) < 0) 
-		killSession("connect() to master failed in heartbeat()");	
-	cout << "connected!" << endl;
-	
-	// Set timeout on heartbeat reads to 5 seconds
-	// This is the inactivity threshold for rebooting the master
-	struct timeval tv;
-	tv.tv_sec = 5;
-	tv.tv_usec = 0;
-	if((setsockopt(h_sock, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv))) < 0)
-		killSession("setsockopt() failed in heartbeat()");
-	
-	cout << "Slave initialization complete, beginning keepalive." << endl;
-	int status;
-	while (true)
-	{
-		// Send heartbeat to master
-    	send(h_sock, heartbeat_msg, strlen(heartbeat_msg), 0); 
-
-		// Attempt to read heartbeat from master
-    	status = read(h_sock, buf, 1024); 
-		if (status <= 0)
-		{
-			#ifdef DEBUG
-				cout << "SLV-DEBUG:  Failed to receive heartbeat message from master, restarting" << endl;
-			#endif		
-
-			// Disconnect from master
-			close(h_sock);
-			
-			// Send message informing router of the masters death
-			send(b_sock, dead_msg, strlen(dead_msg), 0);	
-			
-			// Close if still running and restart the master
-			system("pkill -f tsdm");
-			if(fork() == 0)
-			{
-				#ifdef DEBUG
-					cout << "SLV-DEBUG:  Processed spawned to resurrect master" << endl;
-				#endif
-				const char* args[] = {"./tsdm", "-h", heartbeat_port.c_str(), "-c", client_port.c_str(), "-b", backend_port.c_str(), "-a", router_addr, NULL};
-				execvp(args[0], (char**) args);
-				killSession("exec() failure");
-			} else // Set up signal handler
-			{
-				signal(SIGCHLD, reap);
-			}
-
-			// Wait for master to reboot
-			sleep(2);
-
-			if((h_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
-				killSession("Socket error in heartbeat()");
-
-			// Reconnect to master
-			if (connect(h_sock, (struct sockaddr *)&h_addr, sizeof(h_addr)) < 0) 
-				killSession("connect() to master failed in heartbeat()");				
-
-			if((setsockopt(h_sock, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv))) < 0)
-				killSession("setsockopt() failed in heartbeat()");
-
-			#ifdef DEBUG
-				cout << "SLV-DEBUG:  Restarted master successfully" << endl;
-			#endif
-			continue;
-		}
-
-		// Don't flood master with heartbeat messages
-		sleep(1);
-	}
-}
-
-int main(int argc, char **argv)
-{
-	string client_port = "3010";
-	string backend_port = "3059";
-	string heartbeat_port = "3076";
-	string router_address = "127.0.0.1";
-
-	int opt = 0;
-	while ((opt = getopt(argc, argv, "c:h:b:a:")) != -1)
-	{
-		switch (opt)
-		{
-		case 'c':
-			client_port = optarg;
-			break;
-		case 'h':
-			heartbeat_port = optarg;
-			break;
-		case 'b':
-			backend_port = optarg;
-			break;
-		case 'a':
-			router_address = optarg;
-			break;
-		default:
-			cerr << "Invalid Command Line Argument\n";
-			return -1;
-		}
-	}
-
-	if (client_port == backend_port || client_port == heartbeat_port || heartbeat_port == backend_port)
-		killSession("Invalid port selection, conflicting ports");
-
-	// Start monitoring master server
-	heartbeat(router_address.c_str(), client_port, backend_port, heartbeat_port);
-	return 0;
-}
+#include <ctime>
+#include <cstring>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <grpc++/grpc++.h>
+
+#include "log.h"
+#include "metrics.h"
+#include "replication.h"
+#include "sns.grpc.pb.h"
+#include "supervisor.h"
+
+using grpc::Server;
+using grpc::ServerBuilder;
+using grpc::ServerContext;
+using grpc::Status;
+using csce438::ListReply;
+using csce438::Request;
+using csce438::SNSService;
+using csce438::TimelinePage;
+using csce438::TimelineRequest;
+
+using namespace std;
+
+// Heartbeat and failover metrics
+LatencyMetric heartbeat_rtt("tsns_heartbeat_rtt_seconds", "Round trip time of heartbeats with the peer process");
+Counter peer_restarts("tsns_failovers_total", "Times the peer process was declared dead and restarted");
+
+// Read replica metrics
+LatencyMetric replica_list_latency("tsns_rpc_duration_seconds", "Time spent handling an RPC", "method=\"List\"");
+LatencyMetric replica_get_timeline_latency("tsns_rpc_duration_seconds", "", "method=\"GetTimeline\"");
+Counter mutations_applied("tsns_replica_mutations_applied_total", "Lines of the master's mutation log applied");
+Counter log_restarts("tsns_replica_log_restarts_total", "Times the master started a new mutation log (and the replica started over)");
+
+// Guards the registry and follower graph between the log follower and the read RPCs
+mutex replica_mtx;
+
+// Exit the process with a message in the event of a fatal error
+void killSession(string error) 
+{
+	logger().flush();
+	cerr << "\nSLAVE ERROR: " << error << endl;
+	cerr << "errno: " << errno << endl;
+	cerr << "Slave encountered unrecoverable error!" << endl;
+	cerr << "Server shutting down..." << endl;
+	exit(EXIT_FAILURE);
+}
+
+// Read-only service of a replica: users and follows come from the master's mutation log, posts from the feed files
+// Everything else is left to the master
+class ReplicaServiceImpl final : public SNSService::Service
+{
+	Status List(ServerContext *context, const Request *request, ListReply *list_reply) override
+	{
+		ScopedTimer timer(replica_list_latency);
+		lock_guard<mutex> lock(replica_mtx);
+		int user_index = find_user(request->username());
+		if (user_index < 0)
+			return Status(grpc::StatusCode::NOT_FOUND, "Username \"" + request->username() + "\" not replicated yet");
+		buildListReply(client_db[user_index], list_reply);
+		return Status::OK;
+	}
+
+	Status GetTimeline(ServerContext *context, const TimelineRequest *request, TimelinePage *page) override
+	{
+		ScopedTimer timer(replica_get_timeline_latency);
+		{
+			lock_guard<mutex> lock(replica_mtx);
+			if (find_user(request->username()) < 0)
+				return Status(grpc::StatusCode::NOT_FOUND, "Username \"" + request->username() + "\" not replicated yet");
+		}
+		// Only the feed files are read, no need to hold up the log follower
+		Client user;
+		user.username = request->username();
+		buildTimelinePage(user, *request, page);
+		return Status::OK;
+	}
+};
+
+// Follow the master's mutation log, starting over whenever the master starts a new one
+void followLog(string client_port)
+{
+	MutationLogTail tail(client_port);
+	vector<string> lines;
+	while (true)
+	{
+		lines.clear();
+		bool replaced = tail.poll(lines);
+		if (replaced || !lines.empty())
+		{
+			lock_guard<mutex> lock(replica_mtx);
+			if (replaced)
+			{
+				client_db.clear();
+				log_restarts.add();
+			}
+			for (const string &line : lines)
+				applyMutation(line);
+			mutations_applied.add(lines.size());
+		}
+		this_thread::sleep_for(chrono::milliseconds(REPLICA_POLL_MS));
+	}
+}
+
+// Serve reads of the master's users, follows and timelines on the replica port
+void runReplica(string client_port, string replica_port)
+{
+	thread(followLog, client_port).detach();
+
+	string server_address = "0.0.0.0:" + replica_port;
+	ReplicaServiceImpl service;
+
+	// Answer health checks like a master
+	grpc::EnableDefaultHealthCheckService(true);
+
+	ServerBuilder builder;
+	builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+	builder.RegisterService(&service);
+	unique_ptr<Server> server(builder.BuildAndStart());
+	if (!server)
+		killSession("Could not listen for reads on " + server_address);
+	cout << "Replica serving reads on " << server_address << endl;
+	server->Wait();
+}
+
+// Function to maintain heartbeat message with slave server
+void heartbeat(const char* router_addr, string client_port, string backend_port, string heartbeat_port, string peers, string replica_port) 
+{
+	int h_sock, b_sock;
+	struct sockaddr_in h_addr, b_addr;
+	string heartbeat_msg = "ALIVE " + to_string(getpid());	// Tells the peer which process to supervise
+	string dead_msg = "DEAD " + client_port;
+	char buf[1024] = {0};
+
+	h_addr.sin_family = b_addr.sin_family = AF_INET;
+	h_addr.sin_addr.s_addr = INADDR_ANY;
+	h_addr.sin_port = htons(stoi(heartbeat_port));
+	b_addr.sin_port = htons(stoi(backend_port));
+
+	if((h_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0 || (b_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
+		killSession("Socket error in heartbeat()");
+
+	int opt = 1;
+	if((setsockopt(h_sock, SOL_SOCKET, SO_REUSEADDR, (const char*) &opt, sizeof(opt))) < 0)
+		killSession("setsockopt() failed in heartbeat()");
+    
+	// Convert router address from text to binary form and store in the struct
+    if(inet_pton(AF_INET, router_addr, &b_addr.sin_addr) <= 0)  
+		killSession("Invalid router address in heartbeat()");
+
+	// Convert master address from text to binary form and store in the struct
+    if(inet_pton(AF_INET, "127.0.0.1", &h_addr.sin_addr) <= 0)  
+		killSession("Invalid master address in heartbeat()");
+
+	// Connect to the router 
+	cout << "Slave connecting to router... ";
+	if (connect(b_sock, (struct sockaddr *)&b_addr, sizeof(b_addr)) < 0) 
+		killSession("connect() to router failed in heartbeat()");
+	cout << "connected!" << endl;
+
+	// Tell the router about the read replica, so it can send readers here
+	if (!replica_port.empty())
+	{
+		string replica_msg = "REPLICA " + client_port + " " + replica_port;
+		send(b_sock, replica_msg.c_str(), replica_msg.size(), MSG_NOSIGNAL);
+	}
+	
+	// Connect to the master 
+	cout << "Slave connecting to master... ";
+	if (connect(h_sock, (struct sockaddr *)&h_addr, sizeof(h_addr)) < 0) 
+		killSession("connect() to master failed in heartbeat()");	
+	cout << "connected!" << endl;
+
+	// Supervise exactly the master on the other end, restarting it with the same arguments
+	// (a restarted router rejoins its peer routers)
+	vector<string> args = {"./tsdm", "-h", heartbeat_port, "-c", client_port, "-b", backend_port, "-a", router_addr};
+	if (!peers.empty())
+	{
+		args.push_back("-p");
+		args.push_back(peers);
+	}
+	if (!replica_port.empty())
+	{
+		args.push_back("-R");
+		args.push_back(replica_port);
+	}
+	Supervisor master(args);
+	notifyReady();
+	
+	// Set timeout on heartbeat reads to 5 seconds
+	// This is the inactivity threshold for rebooting the master
+	struct timeval tv;
+	tv.tv_sec = 5;
+	tv.tv_usec = 0;
+	if((setsockopt(h_sock, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv))) < 0)
+		killSession("setsockopt() failed in heartbeat()");
+	
+	cout << "Slave initialization complete, beginning keepalive." << endl;
+	int status;
+	while (true)
+	{
+		// Send heartbeat to master
+		chrono::steady_clock::time_point sent = chrono::steady_clock::now();
+    	send(h_sock, heartbeat_msg.c_str(), heartbeat_msg.size(), MSG_NOSIGNAL); 
+
+		// Attempt to read heartbeat from master
+    	status = read(h_sock, buf, 1024); 
+		if (status > 0)
+		{
+			heartbeat_rtt.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - sent).count());
+			// A peer started from outside is adopted from its first heartbeat,
+			// and a master that hot restarted from its announced pid changing
+			pid_t announced = heartbeatPid(buf, status);
+			if (announced > 0 && master.current() != announced)
+				master.adopt(announced);
+		}
+		else
+		{
+			peer_restarts.add();
+			LOG(LOG_WARN, "master_heartbeat_lost", "pid=%d", (int) master.current());
+
+			// Close if still running (only our own master, other masters and routers may run on this host) and disconnect
+			master.stop();
+			close(h_sock);
+			
+			// Send message informing router of the masters death (identified by its client port)
+			// (the router itself may be the one that died)
+			send(b_sock, dead_msg.c_str(), dead_msg.size(), MSG_NOSIGNAL);	
+			
+			// Restart the master and wait for it to be ready, backing off if it keeps failing
+			LOG(LOG_INFO, "master_restart");
+			int64_t restart_start = monotonicNanos();
+			if (!master.restart())
+				killSession("Master failed to start in heartbeat()");
+			cout << "Restarted master (pid " << master.current() << "), ready after " << (monotonicNanos() - restart_start) / 1000000 << " ms" << endl;
+
+			if((h_sock = socket(AF_INET, SOCK_STREAM, 0)) == 0) 
+				killSession("Socket error in heartbeat()");
+
+			// Reconnect to master (listening for its slave by the time it is ready)
+			if (connect(h_sock, (struct sockaddr *)&h_addr, sizeof(h_addr)) < 0) 
+				killSession("connect() to master failed in heartbeat()");				
+
+			if((setsockopt(h_sock, SOL_SOCKET, SO_RCVTIMEO, (const char*)&tv, sizeof(tv))) < 0)
+				killSession("setsockopt() failed in heartbeat()");
+
+			LOG(LOG_DEBUG, "master_reconnected", "pid=%d", (int) master.current());
+			continue;
+		}
+
+		// Don't flood master with heartbeat messages, but go straight to the restart if it exits meanwhile
+		master.waitForExit(1000);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	string client_port = "3010";
+	string backend_port = "3059";
+	string heartbeat_port = "3076";
+	string router_address = "127.0.0.1";
+	string metrics_port = "";
+	string peers = "";
+	string replica_port = "";
+	string log_level = "";
+
+	int opt = 0;
+	while ((opt = getopt(argc, argv, "c:h:b:a:m:p:R:l:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'c':
+			client_port = optarg;
+			break;
+		case 'h':
+			heartbeat_port = optarg;
+			break;
+		case 'b':
+			backend_port = optarg;
+			break;
+		case 'a':
+			router_address = optarg;
+			break;
+		case 'm':
+			metrics_port = optarg;
+			break;
+		case 'p':
+			peers = optarg;
+			break;
+		case 'R':
+			replica_port = optarg;
+			break;
+		case 'l':
+			log_level = optarg;
+			break;
+		default:
+			cerr << "Invalid Command Line Argument\n";
+			return -1;
+		}
+	}
+
+	if (client_port == backend_port || client_port == heartbeat_port || heartbeat_port == backend_port)
+		killSession("Invalid port selection, conflicting ports");
+	if (!replica_port.empty() && router_address == "127.0.0.1")
+		killSession("Read replicas (-R) are only supported for masters");
+
+	// Log at the given level (changed at runtime with SIGUSR1/SIGUSR2)
+	LogLevel level = (LogLevel) logger().level.load();
+	if (!log_level.empty() && !parseLogLevel(log_level, level))
+		killSession("Unknown log level \"" + log_level + "\", expected debug, info, warn, error or off");
+	logSetup(level);
+
+	// Serve metrics over HTTP if requested
+	if (metrics_port != "")
+		startMetricsServer(metrics_port);
+
+	// Serve reads next to monitoring the master if running as a read replica
+	if (!replica_port.empty())
+		thread(runReplica, client_port, replica_port).detach();
+
+	// Start monitoring master server
+	heartbeat(router_address.c_str(), client_port, backend_port, heartbeat_port, peers, replica_port);
+	return 0;
+}
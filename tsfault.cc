@@ -0,0 +1,644 @@
+/*
+ * tsfault - failover and fault injection harness for Tiny SNS
+ *
+ * Spawns two peer routers and a master (each with its slave) on localhost and
+ * drives a steady stream of posts from one user to a follower through the
+ * client library, the way tsc does. Then, for each kind of fault, it
+ * repeatedly SIGKILLs or SIGSTOPs one of the processes and measures:
+ *
+ *     detect      until the process's supervisor has replaced it (a new
+ *                 process serves the same port)
+ *     redirect    until the routers name a master that answers again, as seen
+ *                 by a prober asking them every millisecond
+ *     delivery    until the follower receives the first post published after
+ *                 the fault
+ *
+ * and counts the posts the master acknowledged that the follower never got,
+ * and the ones it got more than once.
+ */
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpc++/grpc++.h>
+
+#include "tsns_client.h"
+
+using csce438::ListReply;
+using csce438::Message;
+using csce438::Request;
+using csce438::SNSService;
+using grpc::ClientContext;
+using grpc::Status;
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+// Router A (the one faulted), router B and the master, each with its slave
+#define ROUTER_A_PORT "3010"
+#define ROUTER_B_PORT "3020"
+#define MASTER_PORT "3011"
+
+// How long a round waits for the system to detect and recover from a fault
+#define ROUND_TIMEOUT_MS 15000
+// Deadline of the prober's calls to the master
+#define PROBE_DEADLINE_MS 50
+
+struct FaultConfig
+{
+	vector<string> faults = {"router-kill", "router-stop", "master-kill", "master-stop", "slave-kill"};
+	int rounds = 3;		// Per kind of fault
+	int settle_ms = 3000;	// Between faults, longer than a restarted process must run to reset its restart backoff
+	double post_rate = 50;
+	double gate_redirect_ms = 0;
+	bool verbose = false;
+};
+
+// What happened to each post of the load, indexed by its number
+struct PostState
+{
+	bool acked = false;
+	int received = 0;
+};
+
+struct Round
+{
+	string fault;
+	pid_t pid;
+	size_t first_post;	// Posts [first_post, next round's first_post) are counted against this round
+	double detect_ms = -1, redirect_ms = -1, delivery_ms = -1;
+};
+
+// Current time on the monotonic clock in nanoseconds
+int64_t nowNanos()
+{
+	return chrono::duration_cast<chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+// Process group holding every server process spawned by the harness
+pid_t server_group = 0;
+
+// Exit the process with a message in the event of a fatal error, taking any spawned servers down with it
+void killSession(string error)
+{
+	cerr << "\nFAULT ERROR: " << error << endl;
+	cerr << "errno: " << errno << endl;
+	cerr << "Harness shutting down..." << endl;
+	if (server_group != 0)
+		killpg(server_group, SIGKILL);
+	exit(EXIT_FAILURE);
+}
+
+// Start a server process in the harness's server process group
+pid_t spawn(const vector<string> &args, bool verbose)
+{
+	pid_t pid = fork();
+	if (pid < 0)
+		killSession("fork() failed in spawn()");
+	if (pid == 0)
+	{
+		setpgid(0, server_group);
+		if (!verbose)
+		{
+			int null_fd = open("/dev/null", O_WRONLY);
+			dup2(null_fd, STDOUT_FILENO);
+			dup2(null_fd, STDERR_FILENO);
+		}
+		vector<char *> argv;
+		for (const string &arg : args)
+			argv.push_back((char *) arg.c_str());
+		argv.push_back(NULL);
+		execvp(argv[0], argv.data());
+		_exit(127);
+	}
+	setpgid(pid, server_group);
+	if (server_group == 0)
+		server_group = pid;
+	return pid;
+}
+
+// Find the running process of a binary (tsdm or tsds) for the given client port (processes are
+// restarted by their supervisors, so the pid changes every round), 0 if there is none
+pid_t findServer(const string &binary, const string &client_port)
+{
+	pid_t found = 0;
+	DIR *proc = opendir("/proc");
+	if (proc == NULL)
+		killSession("opendir() failed in findServer()");
+	struct dirent *entry;
+	while (found == 0 && (entry = readdir(proc)) != NULL)
+	{
+		pid_t pid = atoi(entry->d_name);
+		if (pid <= 0)
+			continue;
+		ifstream in("/proc/" + string(entry->d_name) + "/cmdline");
+		string cmdline((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+		vector<string> args;
+		for (size_t start = 0, end; start < cmdline.size(); start = end + 1)
+		{
+			end = cmdline.find('\0', start);
+			if (end == string::npos)
+				end = cmdline.size();
+			args.push_back(cmdline.substr(start, end - start));
+		}
+		if (args.empty() || args[0].size() < binary.size()
+				|| args[0].compare(args[0].size() - binary.size(), binary.size(), binary) != 0)
+			continue;
+		for (size_t i = 1; i + 1 < args.size(); i++)
+			if (args[i] == "-c" && args[i + 1] == client_port)
+				found = pid;
+	}
+	closedir(proc);
+	return found;
+}
+
+// Ask a router for the available master, returns "" if there is none (or the router is unreachable)
+string askRouter(const string &router_port)
+{
+	int sock;
+	struct sockaddr_in addr;
+	char buf[1024];
+
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(stoi(router_port));
+	inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+	if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+		killSession("Socket error in askRouter()");
+
+	int status = -1;
+	if (connect(sock, (struct sockaddr *) &addr, sizeof(addr)) == 0)
+		status = read(sock, buf, sizeof(buf));
+	close(sock);
+
+	// A single byte means no master is available
+	if (status <= 1)
+		return "";
+	return string(buf, strnlen(buf, status));
+}
+
+// Ask the routers in order like tsc does, "" if none of them has a master
+string askRouters(const vector<string> &router_ports)
+{
+	for (const string &port : router_ports)
+	{
+		string master = askRouter(port);
+		if (master != "")
+			return master;
+	}
+	return "";
+}
+
+// Wait until a router answers with a master, returns how long that took (negative on timeout)
+double waitForRedirect(const string &router_port, int timeout_ms)
+{
+	Clock::time_point start = Clock::now();
+	while (Clock::now() - start < chrono::milliseconds(timeout_ms))
+	{
+		if (askRouter(router_port) != "")
+			return chrono::duration<double, milli>(Clock::now() - start).count();
+		this_thread::sleep_for(chrono::microseconds(500));
+	}
+	return -1;
+}
+
+// The process a kind of fault is injected into, and the signal it gets
+bool faultTarget(const string &fault, string &binary, string &port, int &signal)
+{
+	binary = "tsdm";
+	port = fault.compare(0, 7, "router-") == 0 ? ROUTER_A_PORT : MASTER_PORT;
+	signal = fault.size() > 5 && fault.compare(fault.size() - 5, 5, "-stop") == 0 ? SIGSTOP : SIGKILL;
+	if (fault == "slave-kill")
+		binary = "tsds";
+	return fault == "router-kill" || fault == "router-stop" || fault == "master-kill" || fault == "master-stop"
+		|| fault == "slave-kill";
+}
+
+// Keep a user connected with its timeline stream open, connecting again whenever the stream is lost
+// A follower follows again each time (a master restarted by its slave starts with an empty registry)
+// and subscribes from the newest post it has, like tsc with its cache
+void keepSubscribed(shared_ptr<SnsSession> session, string followee, function<void(const Message &)> on_post,
+					atomic<uint64_t> &newest_post, atomic<bool> &running)
+{
+	while (running)
+	{
+		if (session->connect() < SnsSession::CONNECTED_SAME)
+		{
+			this_thread::sleep_for(chrono::milliseconds(10));
+			continue;
+		}
+		bool following = followee.empty();
+		while (running && !following)
+		{
+			CommandResult result = session->follow(followee).get();
+			if (sessionLost(result.status))
+				break;
+			following = result.msg == "Follow Successful" || result.msg == "Follow Failed -- Already Following User";
+			if (!following)
+				this_thread::sleep_for(chrono::milliseconds(10));
+		}
+		if (!following)
+			continue;
+		future<Status> lost = session->subscribe(on_post, newest_post);
+		while (running && lost.wait_for(chrono::milliseconds(50)) != future_status::ready);
+	}
+	session->close();
+}
+
+// Format a duration measured in a round, "-" if it was not seen
+string formatMs(double ms)
+{
+	if (ms < 0)
+		return "-";
+	ostringstream out;
+	out.precision(1);
+	out << fixed << ms << " ms";
+	return out.str();
+}
+
+void usage()
+{
+	cerr << "usage: tsfault [-F fault[,fault...]] [-k rounds per fault] [-s settle ms] [-r posts/s]\n"
+		 << "               [-G max redirect ms] [-v]\n"
+		 << "       faults: router-kill, router-stop, master-kill, master-stop, slave-kill\n";
+}
+
+int main(int argc, char **argv)
+{
+	FaultConfig config;
+
+	int opt = 0;
+	while ((opt = getopt(argc, argv, "F:k:s:r:G:v")) != -1)
+	{
+		switch (opt)
+		{
+		case 'F':
+		{
+			config.faults.clear();
+			stringstream list(optarg);
+			string fault;
+			while (getline(list, fault, ','))
+				config.faults.push_back(fault);
+			break;
+		}
+		case 'k':
+			config.rounds = max(1, atoi(optarg));
+			break;
+		case 's':
+			config.settle_ms = max(0, atoi(optarg));
+			break;
+		case 'r':
+			config.post_rate = max(1.0, atof(optarg));
+			break;
+		case 'G':
+			config.gate_redirect_ms = atof(optarg);
+			break;
+		case 'v':
+			config.verbose = true;
+			break;
+		default:
+			usage();
+			return -1;
+		}
+	}
+	for (const string &fault : config.faults)
+	{
+		string binary, port;
+		int signal;
+		if (!faultTarget(fault, binary, port, signal))
+		{
+			usage();
+			return -1;
+		}
+	}
+
+	// Routers A and B replicate their tables to each other through their backend ports
+	// The master registers with A only (through a second loopback address since "127.0.0.1" selects router mode)
+	cout << "Starting routers (ports " ROUTER_A_PORT ", " ROUTER_B_PORT ") and master (port " MASTER_PORT ")..." << endl;
+	spawn({"./tsdm", "-a", "127.0.0.1", "-c", ROUTER_A_PORT, "-b", "3059", "-h", "3076", "-p", "127.0.0.1:3069"}, config.verbose);
+	spawn({"./tsdm", "-a", "127.0.0.1", "-c", ROUTER_B_PORT, "-b", "3069", "-h", "3086", "-p", "127.0.0.1:3059"}, config.verbose);
+	usleep(500000);
+	spawn({"./tsds", "-a", "127.0.0.1", "-c", ROUTER_A_PORT, "-b", "3059", "-h", "3076", "-p", "127.0.0.1:3069"}, config.verbose);
+	spawn({"./tsds", "-a", "127.0.0.1", "-c", ROUTER_B_PORT, "-b", "3069", "-h", "3086", "-p", "127.0.0.1:3059"}, config.verbose);
+	sleep(1);
+	spawn({"./tsdm", "-a", "127.0.0.2", "-c", MASTER_PORT, "-b", "3059", "-h", "3077"}, config.verbose);
+	sleep(1);
+	spawn({"./tsds", "-a", "127.0.0.2", "-c", MASTER_PORT, "-b", "3059", "-h", "3077"}, config.verbose);
+
+	// Both routers know the master once A has synced its table to B
+	if (waitForRedirect(ROUTER_A_PORT, 10000) < 0 || waitForRedirect(ROUTER_B_PORT, 10000) < 0)
+		killSession("Master never became available through both routers");
+	cout << "Both routers direct clients to " << askRouter(ROUTER_B_PORT) << endl;
+
+	// Ask the router list for a master continuously, and the master named for an answer, tracking the longest
+	// stretch without one and when the latest answer was asked for
+	vector<string> router_ports = {ROUTER_A_PORT, ROUTER_B_PORT};
+	atomic<bool> probing(true);
+	atomic<uint64_t> asks(0), misses(0);
+	atomic<int64_t> max_gap_ns(0);
+	mutex probe_mtx;
+	int64_t answer_asked_ns = 0, answer_ns = 0;
+	thread prober([&]()
+	{
+		// Reconnect to a restarted master right away, so the redirect time is the servers' and not the channel's backoff
+		grpc::ChannelArguments args;
+		args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, 10);
+		args.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, 10);
+		args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, 100);
+		map<string, unique_ptr<SNSService::Stub>> stubs;
+		int64_t last_answer = nowNanos();
+		while (probing)
+		{
+			int64_t asked = nowNanos();
+			string master = askRouters(router_ports);
+			bool answered = false;
+			if (master != "")
+			{
+				unique_ptr<SNSService::Stub> &stub = stubs[master];
+				if (!stub)
+					stub = SNSService::NewStub(grpc::CreateCustomChannel(master, grpc::InsecureChannelCredentials(), args));
+				Request request;
+				request.set_username("tsfault_probe");
+				ListReply reply;
+				ClientContext context;
+				context.set_deadline(chrono::system_clock::now() + chrono::milliseconds(PROBE_DEADLINE_MS));
+				Status status = stub->List(&context, request, &reply);
+				answered = status.ok() || status.error_code() == grpc::StatusCode::NOT_FOUND;
+			}
+			int64_t now = nowNanos();
+			asks++;
+			if (!answered)
+				misses++;
+			if (now - last_answer > max_gap_ns)
+				max_gap_ns = now - last_answer;
+			if (answered)
+			{
+				last_answer = now;
+				lock_guard<mutex> lock(probe_mtx);
+				answer_asked_ns = asked;
+				answer_ns = now;
+			}
+			this_thread::sleep_for(chrono::milliseconds(1));
+		}
+	});
+
+	// Steady load: one user posting numbered posts, another following it
+	string prefix = "fault" + to_string(getpid()) + "_";
+	string poster_name = prefix + "poster";
+	SnsClient client(ROUTER_A_PORT ",127.0.0.1:" ROUTER_B_PORT, ROUTER_A_PORT);
+	shared_ptr<SnsSession> poster = client.session(poster_name);
+	shared_ptr<SnsSession> follower = client.session(prefix + "follower");
+	mutex posts_mtx;
+	vector<PostState> posts;
+	atomic<int64_t> delivery_from(-1), first_delivery_ns(0);
+	atomic<uint64_t> poster_newest(0), follower_newest(0);
+	atomic<bool> running(true), posting(true);
+
+	thread poster_stream(keepSubscribed, poster, string(), [&](const Message &) {}, ref(poster_newest), ref(running));
+	thread follower_stream(keepSubscribed, follower, poster_name, [&](const Message &m)
+	{
+		if (m.username() != poster_name || m.msg().compare(0, 5, "post ") != 0)
+			return;
+		uint64_t newest = follower_newest;
+		while (m.post_id() > newest && !follower_newest.compare_exchange_weak(newest, m.post_id()));
+		int64_t n = atoll(m.msg().c_str() + 5);
+		{
+			lock_guard<mutex> lock(posts_mtx);
+			if (n >= 0 && n < (int64_t) posts.size())
+				posts[n].received++;
+		}
+		int64_t from = delivery_from, none = 0;
+		if (from >= 0 && n >= from)
+			first_delivery_ns.compare_exchange_strong(none, nowNanos());
+	}, ref(follower_newest), ref(running));
+
+	// Publish at a fixed rate, noting each post once the master has it
+	// A post the master's rate limit turned away is published again once it says to, like tsc does
+	// (once stopped, the remaining posts are waited for)
+	atomic<uint64_t> retried(0);
+	thread load([&]()
+	{
+		deque<pair<size_t, future<PublishResult>>> inflight;
+		deque<pair<Clock::time_point, size_t>> retries;
+		auto settle = [&](pair<size_t, future<PublishResult>> &post)
+		{
+			PublishResult result = post.second.get();
+			if (!result.accepted)
+			{
+				retried++;
+				retries.push_back(make_pair(Clock::now() + chrono::milliseconds(result.retry_after_ms), post.first));
+				return;
+			}
+			lock_guard<mutex> lock(posts_mtx);
+			posts[post.first].acked = true;
+		};
+		chrono::nanoseconds interval((int64_t) (1e9 / config.post_rate));
+		Clock::time_point next = Clock::now();
+		Clock::time_point give_up = Clock::time_point::max();
+		while (!inflight.empty() || !retries.empty() || posting)
+		{
+			this_thread::sleep_until(next);
+			next += interval;
+			if (posting)
+			{
+				size_t n;
+				{
+					lock_guard<mutex> lock(posts_mtx);
+					n = posts.size();
+					posts.push_back(PostState());
+				}
+				inflight.push_back(make_pair(n, poster->publish("post " + to_string(n))));
+			}
+			// At most one retry per post, so a backlog sent after an outage drains at the posting rate instead
+			// of being turned away over and over
+			else if (give_up == Clock::time_point::max())
+				give_up = Clock::now() + chrono::seconds(10);
+			if (!retries.empty() && retries.front().first <= Clock::now())
+			{
+				inflight.push_back(make_pair(retries.front().second, poster->publish("post " + to_string(retries.front().second))));
+				retries.pop_front();
+			}
+			while (!inflight.empty() && inflight.front().second.wait_for(chrono::seconds(0)) == future_status::ready)
+			{
+				settle(inflight.front());
+				inflight.pop_front();
+			}
+			// Posts still not on the master 10 seconds after the load stopped count as never acknowledged
+			if (Clock::now() > give_up)
+				break;
+		}
+	});
+
+	// The load must be flowing before any fault
+	delivery_from = 0;
+	for (int i = 0; i < 1000 && first_delivery_ns == 0; i++)
+		this_thread::sleep_for(chrono::milliseconds(10));
+	if (first_delivery_ns == 0)
+		killSession("Posts are not reaching the follower");
+	cout << "Load running: " << config.post_rate << " posts/s from " << poster_name << " to its follower" << endl;
+
+	vector<Round> rounds;
+	for (const string &fault : config.faults)
+	{
+		string binary, port;
+		int signal;
+		faultTarget(fault, binary, port, signal);
+		for (int r = 1; r <= config.rounds; r++)
+		{
+			Round round;
+			round.fault = fault;
+			{
+				lock_guard<mutex> lock(posts_mtx);
+				round.first_post = posts.size();
+			}
+			this_thread::sleep_for(chrono::milliseconds(config.settle_ms));
+			if ((round.pid = findServer(binary, port)) == 0)
+				killSession("No " + binary + " running for port " + port);
+
+			// Inject the fault, then watch for the replacement process, an answering master and a delivery
+			first_delivery_ns = 0;
+			int64_t injected = nowNanos();
+			kill(round.pid, signal);
+			{
+				lock_guard<mutex> lock(posts_mtx);
+				delivery_from = posts.size();
+			}
+			while (nowNanos() - injected < ROUND_TIMEOUT_MS * 1000000LL
+					&& (round.detect_ms < 0 || round.redirect_ms < 0 || round.delivery_ms < 0))
+			{
+				if (round.detect_ms < 0)
+				{
+					pid_t current = findServer(binary, port);
+					if (current != 0 && current != round.pid)
+						round.detect_ms = (nowNanos() - injected) / 1e6;
+				}
+				if (round.redirect_ms < 0)
+				{
+					lock_guard<mutex> lock(probe_mtx);
+					if (answer_asked_ns > injected)
+						round.redirect_ms = (answer_ns - injected) / 1e6;
+				}
+				if (round.delivery_ms < 0 && first_delivery_ns != 0)
+					round.delivery_ms = (first_delivery_ns - injected) / 1e6;
+				this_thread::sleep_for(chrono::milliseconds(2));
+			}
+			// A stopped process its supervisor has not replaced carries on
+			if (signal == SIGSTOP)
+				kill(round.pid, SIGCONT);
+			cout << " " << fault << " round " << r << " (pid " << round.pid << "): detect " << formatMs(round.detect_ms)
+				 << ", redirect " << formatMs(round.redirect_ms) << ", first delivery " << formatMs(round.delivery_ms) << endl;
+			rounds.push_back(round);
+		}
+	}
+
+	// Let the last round's posts arrive, then stop the load
+	this_thread::sleep_for(chrono::milliseconds(config.settle_ms));
+	posting = false;
+	load.join();
+	this_thread::sleep_for(chrono::seconds(1));
+	running = false;
+	poster_stream.join();
+	follower_stream.join();
+	probing = false;
+	prober.join();
+
+	// Count each round's posts (from the start of its settle time to the next one's): acknowledged but
+	// never delivered, delivered more than once, and never acknowledged
+	size_t published = posts.size(), acked = 0, delivered = 0;
+	for (const PostState &post : posts)
+	{
+		acked += post.acked;
+		delivered += post.received > 0;
+	}
+	cout << "========= tsfault results =========\n";
+	cout << " posts:                  " << published << " published, " << acked << " acknowledged, "
+		 << delivered << " delivered, " << retried << " published again after the rate limit\n";
+	cout << " router list asks:       " << asks << ", " << misses << " without an answering master, longest gap "
+		 << max_gap_ns / 1e6 << " ms\n";
+	int failed_rounds = 0;
+	double max_redirect_ms = 0;
+	ostringstream results;
+	for (const string &fault : config.faults)
+	{
+		int n = 0, failed = 0;
+		double detect = 0, redirect = 0, delivery = 0, max_detect = 0, max_redirect = 0, max_delivery = 0;
+		uint64_t lost = 0, duplicated = 0, unacked = 0;
+		for (size_t i = 0; i < rounds.size(); i++)
+		{
+			const Round &round = rounds[i];
+			if (round.fault != fault)
+				continue;
+			size_t end = i + 1 < rounds.size() ? rounds[i + 1].first_post : published;
+			for (size_t p = round.first_post; p < end; p++)
+			{
+				lost += posts[p].acked && posts[p].received == 0;
+				duplicated += posts[p].received > 1 ? posts[p].received - 1 : 0;
+				unacked += !posts[p].acked;
+			}
+			if (round.detect_ms < 0 || round.redirect_ms < 0 || round.delivery_ms < 0)
+			{
+				failed++;
+				continue;
+			}
+			n++;
+			detect += round.detect_ms;
+			redirect += round.redirect_ms;
+			delivery += round.delivery_ms;
+			max_detect = max(max_detect, round.detect_ms);
+			max_redirect = max(max_redirect, round.redirect_ms);
+			max_delivery = max(max_delivery, round.delivery_ms);
+		}
+		failed_rounds += failed;
+		max_redirect_ms = max(max_redirect_ms, max_redirect);
+		cout << " " << fault << ": " << config.rounds << " rounds (" << failed << " without recovery)\n"
+			 << "   detect mean " << formatMs(n ? detect / n : 0) << ", max " << formatMs(max_detect)
+			 << "; redirect mean " << formatMs(n ? redirect / n : 0) << ", max " << formatMs(max_redirect)
+			 << "; first delivery mean " << formatMs(n ? delivery / n : 0) << ", max " << formatMs(max_delivery) << "\n"
+			 << "   posts lost " << lost << ", duplicated " << duplicated << ", never acknowledged " << unacked << "\n";
+
+		// One machine-readable line per kind of fault for tracking results between builds
+		results << "tsfault-result fault=" << fault << " rounds=" << config.rounds << " failed_rounds=" << failed
+				<< " mean_detect_ms=" << (n ? detect / n : 0) << " max_detect_ms=" << max_detect
+				<< " mean_redirect_ms=" << (n ? redirect / n : 0) << " max_redirect_ms=" << max_redirect
+				<< " mean_delivery_ms=" << (n ? delivery / n : 0) << " max_delivery_ms=" << max_delivery
+				<< " lost=" << lost << " duplicated=" << duplicated << " unacked=" << unacked << "\n";
+	}
+	cout << "===================================\n";
+	cout << results.str() << flush;
+
+	killpg(server_group, SIGKILL);
+	while (waitpid(-server_group, NULL, 0) > 0);
+
+	// Fail the run if it is being used as a regression gate
+	if (failed_rounds > 0)
+	{
+		cerr << "tsfault: the system did not recover from every fault" << endl;
+		return 1;
+	}
+	if (config.gate_redirect_ms > 0 && max_redirect_ms > config.gate_redirect_ms)
+	{
+		cerr << "tsfault: longest redirect above the " << config.gate_redirect_ms << "ms gate" << endl;
+		return 1;
+	}
+	return 0;
+}
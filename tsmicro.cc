@@ -0,0 +1,315 @@
+/*
+ * tsmicro - microbenchmarks for the master's (tsdm) hot paths
+ *
+ * Runs find_user(), the per-post fan-out, the stream-open replay and
+ * GetTimeline paging of the following feed, post encoding, admission control and LIST reply construction in
+ * isolation at a range of user, follower and file sizes, and compares the
+ * storage backends' fan-out (posts/s and latency percentiles) at high follower counts. Every result is
+ * printed as one JSON object per line so runs can be compared between commits.
+ * Timeline files are written to a scratch directory that is removed afterwards.
+ */
+
+#include <unistd.h>
+#include <cstdlib>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/util/time_util.h>
+
+#include "histogram.h"
+#include "server.h"
+
+using csce438::ListReply;
+using csce438::Message;
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+// Sink for benchmark results so the compiler cannot discard the measured work
+volatile size_t sink;
+
+// Minimum time to spend measuring each benchmark
+double min_seconds = 0.2;
+
+// Label attached to every result line (e.g. a commit id)
+string tag = "";
+
+// Run op repeatedly for at least min_seconds (in doubling batches) and print one JSON result line
+void measure(const string &name, const string &params, const function<void()> &op)
+{
+	// Warm up caches and the allocator
+	op();
+
+	uint64_t iterations = 0, batch = 1;
+	Clock::time_point start = Clock::now();
+	double elapsed = 0;
+	while (elapsed < min_seconds)
+	{
+		for (uint64_t i = 0; i < batch; i++)
+			op();
+		iterations += batch;
+		batch *= 2;
+		elapsed = chrono::duration<double>(Clock::now() - start).count();
+	}
+
+	cout << "{\"bench\":\"" << name << "\"," << params
+		 << ",\"iterations\":" << iterations
+		 << ",\"ns_per_op\":" << elapsed * 1e9 / iterations;
+	if (tag != "")
+		cout << ",\"tag\":\"" << tag << "\"";
+	cout << "}" << endl;
+}
+
+// Run op back to back for at least min_seconds, timing each call, and print one JSON result line
+// with the rate and latency percentiles
+void measureLatency(const string &name, const string &params, const function<void()> &op)
+{
+	op();
+
+	LatencyHistogram latency;
+	uint64_t iterations = 0;
+	Clock::time_point start = Clock::now(), now = start;
+	while (chrono::duration<double>(now - start).count() < min_seconds)
+	{
+		Clock::time_point op_start = now;
+		op();
+		now = Clock::now();
+		latency.record(chrono::duration_cast<chrono::nanoseconds>(now - op_start).count());
+		iterations++;
+	}
+	double elapsed = chrono::duration<double>(now - start).count();
+
+	cout << "{\"bench\":\"" << name << "\"," << params
+		 << ",\"iterations\":" << iterations
+		 << ",\"ops_per_sec\":" << iterations / elapsed
+		 << ",\"p50_ns\":" << latency.percentile(0.50)
+		 << ",\"p99_ns\":" << latency.percentile(0.99)
+		 << ",\"max_ns\":" << latency.max();
+	if (tag != "")
+		cout << ",\"tag\":\"" << tag << "\"";
+	cout << "}" << endl;
+}
+
+// Parse a comma separated list of sizes, e.g. "100,1000,10000"
+vector<int> parseSizes(const string &list)
+{
+	vector<int> sizes;
+	stringstream ss(list);
+	string item;
+	while (getline(ss, item, ','))
+		if (atoi(item.c_str()) > 0)
+			sizes.push_back(atoi(item.c_str()));
+	return sizes;
+}
+
+// Replace the registry with n users named user0..user{n-1}
+void populateUsers(int n)
+{
+	client_db.clear();
+	for (int i = 0; i < n; i++)
+	{
+		Client c;
+		c.username = "user" + to_string(i);
+		client_db.push_back(c);
+	}
+}
+
+// Remove every user's timeline files (and the descriptors the storage backend keeps open on them)
+void removeFeeds()
+{
+	feedBackend()->closeFeeds();
+	for (Client &c : client_db)
+	{
+		unlink(userFeedPath(c.username).c_str());
+		unlink(followingFeedPath(c.username).c_str());
+		unlink(feedIndexPath(followingFeedPath(c.username)).c_str());
+	}
+}
+
+// Make user 0 followed by the first f other users
+void addFollowers(int f)
+{
+	for (int i = 1; i <= f && i < (int) client_db.size(); i++)
+	{
+		client_db[0].client_followers.push_back(&client_db[i]);
+		client_db[i].client_following.push_back(&client_db[0]);
+	}
+}
+
+Message samplePost()
+{
+	Message m;
+	m.set_username("user0");
+	m.set_msg("the quick brown fox jumps over the lazy dog");
+	m.mutable_timestamp()->set_seconds(1600000000);
+	m.mutable_timestamp()->set_nanos(123456789);
+	return m;
+}
+
+void usage()
+{
+	cerr << "usage: tsmicro [-u user counts] [-f follower counts] [-l following feed post counts]\n"
+		 << "               [-b backend follower counts] [-s min seconds per benchmark] [-t tag]\n";
+}
+
+int main(int argc, char **argv)
+{
+	vector<int> user_sizes = {100, 1000, 10000};
+	vector<int> follower_sizes = {1, 10, 100};
+	vector<int> line_sizes = {100, 10000, 100000};
+	vector<int> backend_follower_sizes = {100, 1000, 5000};
+
+	int opt = 0;
+	while ((opt = getopt(argc, argv, "u:f:l:b:s:t:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'u':
+			user_sizes = parseSizes(optarg);
+			break;
+		case 'f':
+			follower_sizes = parseSizes(optarg);
+			break;
+		case 'l':
+			line_sizes = parseSizes(optarg);
+			break;
+		case 'b':
+			backend_follower_sizes = parseSizes(optarg);
+			break;
+		case 's':
+			min_seconds = atof(optarg);
+			break;
+		case 't':
+			tag = optarg;
+			break;
+		default:
+			usage();
+			return -1;
+		}
+	}
+
+	// Keep timeline files out of the working directory
+	char scratch[] = "/tmp/tsmicro.XXXXXX";
+	if (mkdtemp(scratch) == NULL || chdir(scratch) < 0)
+	{
+		cerr << "Could not create scratch directory" << endl;
+		return 1;
+	}
+
+	// find_user(): a hit in the middle of the registry and a miss
+	for (int n : user_sizes)
+	{
+		populateUsers(n);
+		string middle = "user" + to_string(n / 2);
+		string params = "\"users\":" + to_string(n);
+		measure("find_user_hit", params, [&]() { sink = find_user(middle); });
+		measure("find_user_miss", params, [&]() { sink = find_user("nobody"); });
+	}
+
+	// Post encoding, against the text formatting (TimeUtil::ToString) it replaced
+	Message post = samplePost();
+	measure("encode_post", "\"msg_bytes\":" + to_string(post.msg().size()), [&]() { sink = encodePost(post).size(); });
+	measure("timestamp_to_string", "\"nanos\":1", [&]() {
+		sink = google::protobuf::util::TimeUtil::ToString(post.timestamp()).size();
+	});
+
+	// Admission decisions: a post token (always available) and an in-flight slot
+	{
+		TokenBucket bucket;
+		RateLimit unlimited_burst(1e9, 1e9);
+		int64_t retry_after_ns;
+		measure("rate_limit_admit", "\"threads\":1", [&]() {
+			sink = bucket.admit(unlimited_burst, monotonicNanos(), retry_after_ns);
+		});
+		InflightBudget budget(1024);
+		measure("inflight_guard", "\"threads\":1", [&]() {
+			InflightGuard guard(budget);
+			sink = guard.admitted;
+		});
+	}
+
+	// LIST reply construction
+	for (int n : user_sizes)
+	{
+		for (int f : follower_sizes)
+		{
+			if (f >= n)
+				continue;
+			populateUsers(n);
+			addFollowers(f);
+			string params = "\"users\":" + to_string(n) + ",\"followers\":" + to_string(f);
+			measure("list_reply", params, [&]() {
+				ListReply reply;
+				buildListReply(client_db[0], &reply);
+				sink = reply.all_users_size();
+			});
+		}
+	}
+
+	// Fan-out of one post to every follower's files (no live streams)
+	for (int f : follower_sizes)
+	{
+		populateUsers(f + 1);
+		addFollowers(f);
+		string record = encodePost(post);
+		measure("fan_out", "\"followers\":" + to_string(f), [&]() { fanOutPost(&client_db[0], post, record); });
+		removeFeeds();
+	}
+
+	// Fan-out through each storage backend at high follower counts: posts/s and per-post latency
+	for (const string backend : {"sync", "uring"})
+	{
+		selectFeedBackend(backend);
+		if (feedBackend()->name() != backend)
+		{
+			cerr << "Storage backend " << backend << " not available, skipped" << endl;
+			continue;
+		}
+		for (int f : backend_follower_sizes)
+		{
+			populateUsers(f + 1);
+			addFollowers(f);
+			string record = encodePost(post);
+			string params = "\"backend\":\"" + backend + "\",\"followers\":" + to_string(f);
+			measureLatency("fan_out_backend", params, [&]() { fanOutPost(&client_db[0], post, record); });
+			removeFeeds();
+		}
+	}
+	selectFeedBackend("sync");
+
+	// Stream-open replay of the newest 20 posts, and a GetTimeline page from the middle of the following feed
+	for (int lines : line_sizes)
+	{
+		populateUsers(1);
+		Client &reader = client_db[0];
+		{
+			ofstream following(followingFeedPath(reader.username), ios::binary);
+			string record = encodePost(post);
+			for (int i = 0; i < lines; i++)
+				following << record;
+		}
+		measure("tail_read", "\"lines\":" + to_string(lines), [&]() {
+			vector<Message> newest;
+			readNewestPosts(&reader, newest);
+			sink = newest.size();
+		});
+		csce438::TimelineRequest request;
+		request.set_username(reader.username);
+		request.set_before_post_id(lines / 2);
+		measure("timeline_page", "\"lines\":" + to_string(lines), [&]() {
+			csce438::TimelinePage page;
+			buildTimelinePage(reader, request, &page);
+			sink = page.posts_size();
+		});
+		unlink(feedIndexPath(followingFeedPath(reader.username)).c_str());
+		unlink(followingFeedPath(reader.username).c_str());
+	}
+
+	rmdir(scratch);
+	return 0;
+}
@@ -0,0 +1,524 @@
+/*
+ * tsmigrate - convert legacy text timelines to the indexed feed format
+ *
+ * Deployments from before the binary format (storage.h) keep a user's
+ * timelines in USER.txt and USERfollowing.txt, one entry per post as the old
+ * master's Timeline wrote it:
+ *
+ *     2026-10-18T09:30:00.123456Z :: alice:message text
+ *
+ * The text is what the client sent, usually ending in a newline of its own,
+ * so entries tend to be separated by an empty line. tsmigrate writes USER.dat
+ * and USERfollowing.dat (with its index) next to them, and with '-T' puts all
+ * but the newest posts of a following feed straight into its cold tier, the
+ * way the master's compaction thread would.
+ *
+ * Files are converted in parallel, largest first, one per worker thread at a
+ * time. Each is mapped into memory and cut into lines with memchr (vectorized
+ * by the C library); an entry starts at every line beginning with a timestamp
+ * followed by " :: " and the poster's name, and runs up to the next one. The
+ * output is written under a temporary name and renamed into place, the .dat
+ * last; files that already have a .dat are left alone unless '-f' is given.
+ * The .txt files are kept.
+ */
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <google/protobuf/util/time_util.h>
+
+#include "storage.h"
+
+using google::protobuf::Timestamp;
+using google::protobuf::util::TimeUtil;
+
+using namespace std;
+
+// Suffix of the files being written, renamed into place once complete
+#define MIGRATE_SUFFIX ".migrate"
+
+struct MigrateConfig
+{
+	vector<string> inputs;		// Directories (their .txt files) and .txt files
+	int threads = 0;			// 0: one per CPU
+	uint64_t hot_posts = 0;		// Newest posts of a following feed kept out of the cold tier (0: no cold tier)
+	int level = 6;				// zlib level of the cold blocks
+	bool force = false;			// Overwrite feeds that were already converted
+};
+
+struct MigrateStats
+{
+	atomic<uint64_t> files{0};
+	atomic<uint64_t> existing{0};
+	atomic<uint64_t> not_timelines{0};
+	atomic<uint64_t> failed{0};
+	atomic<uint64_t> posts{0};
+	atomic<uint64_t> cold_posts{0};
+	atomic<uint64_t> bytes_in{0};
+	atomic<uint64_t> bytes_out{0};
+	atomic<uint64_t> stray_bytes{0};	// Bytes before a file's first entry, not part of any post
+};
+
+// The posts of one file, encoded as feed records
+struct ParsedFeed
+{
+	string records;
+	vector<uint64_t> offsets;	// Of each record in records
+	vector<int64_t> seconds;	// Timestamp of each record
+
+	void clear()
+	{
+		records.clear();
+		offsets.clear();
+		seconds.clear();
+	}
+};
+
+void killSession(string error)
+{
+	cerr << "\nMIGRATE ERROR: " << error << endl;
+	cerr << "Migration shutting down..." << endl;
+	exit(EXIT_FAILURE);
+}
+
+bool endsWith(const string &s, const string &suffix)
+{
+	return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+bool digits(const char *p, int n, int &value)
+{
+	value = 0;
+	for (int i = 0; i < n; i++)
+	{
+		if (p[i] < '0' || p[i] > '9')
+			return false;
+		value = value * 10 + (p[i] - '0');
+	}
+	return true;
+}
+
+// Days from 1970-01-01 to a date of the proleptic Gregorian calendar
+int64_t daysFromCivil(int64_t year, int month, int day)
+{
+	year -= month <= 2;
+	int64_t era = (year >= 0 ? year : year - 399) / 400;
+	int64_t year_of_era = year - era * 400;
+	int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+	return era * 146097 + day_of_era - 719468;
+}
+
+// Parse the timestamp a line starts with, as TimeUtil::ToString() wrote it (UTC, 0 to 9 fraction digits;
+// anything else RFC 3339 goes through TimeUtil); returns its length, 0 if the line does not start with one
+size_t parseTimestamp(const char *p, const char *end, int64_t &seconds, int32_t &nanos)
+{
+	int year, month, day, hour, minute, second;
+	if (end - p < 20 || !digits(p, 4, year) || p[4] != '-' || !digits(p + 5, 2, month) || p[7] != '-'
+			|| !digits(p + 8, 2, day) || p[10] != 'T' || !digits(p + 11, 2, hour) || p[13] != ':'
+			|| !digits(p + 14, 2, minute) || p[16] != ':' || !digits(p + 17, 2, second))
+		return 0;
+	const char *q = p + 19;
+	nanos = 0;
+	if (*q == '.')
+	{
+		int n = 0;
+		for (q++; q < end && n < 9 && *q >= '0' && *q <= '9'; q++, n++)
+			nanos = nanos * 10 + (*q - '0');
+		for (int i = n; i < 9; i++)
+			nanos *= 10;
+		if (n == 0)
+			return 0;
+	}
+	if (q < end && *q == 'Z' && month >= 1 && month <= 12 && day >= 1 && day <= 31 && hour < 24 && minute < 60 && second < 61)
+	{
+		seconds = daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+		return q + 1 - p;
+	}
+
+	// (a UTC offset, or something odd)
+	const char *space = (const char *) memchr(p, ' ', end - p);
+	Timestamp ts;
+	if (space == NULL || !TimeUtil::FromString(string(p, space - p), &ts))
+		return 0;
+	seconds = ts.seconds();
+	nanos = ts.nanos();
+	return space - p;
+}
+
+char *putVarint(char *p, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		*p++ = (char) (value | 0x80);
+		value >>= 7;
+	}
+	*p++ = (char) value;
+	return p;
+}
+
+size_t varintSize(uint64_t value)
+{
+	size_t size = 1;
+	for (; value >= 0x80; value >>= 7)
+		size++;
+	return size;
+}
+
+// A post as a record, byte for byte what encodePost() makes of a Message with its username, msg and
+// timestamp set (fields in order, the ones holding their default value left out), without building one
+void appendEntry(string &out, const char *user, size_t user_len, const char *text, size_t text_len, int64_t seconds, int32_t nanos)
+{
+	size_t timestamp_len = (seconds != 0 ? 1 + varintSize(seconds) : 0) + (nanos != 0 ? 1 + varintSize(nanos) : 0);
+	size_t len = 1 + varintSize(user_len) + user_len + (text_len > 0 ? 1 + varintSize(text_len) + text_len : 0)
+		+ 1 + varintSize(timestamp_len) + timestamp_len;
+
+	// The parts around the username and text are put together on the stack, then appended with them
+	char head[RECORD_HEADER_SIZE + 32], tail[32];
+	for (int i = 0; i < RECORD_HEADER_SIZE; i++)
+		head[i] = (char) ((len >> (8 * i)) & 0xff);
+	char *p = head + RECORD_HEADER_SIZE;
+	*p++ = '\x0a';
+	p = putVarint(p, user_len);
+	out.append(head, p - head);
+	out.append(user, user_len);
+	if (text_len > 0)
+	{
+		p = head;
+		*p++ = '\x12';
+		p = putVarint(p, text_len);
+		out.append(head, p - head);
+		out.append(text, text_len);
+	}
+	p = tail;
+	*p++ = '\x1a';
+	p = putVarint(p, timestamp_len);
+	if (seconds != 0)
+	{
+		*p++ = '\x08';
+		p = putVarint(p, seconds);
+	}
+	if (nanos != 0)
+	{
+		*p++ = '\x10';
+		p = putVarint(p, nanos);
+	}
+	out.append(tail, p - tail);
+}
+
+// The start of an entry: its poster, timestamp and where its text starts
+struct EntryStart
+{
+	const char *user;
+	size_t user_len;
+	int64_t seconds;
+	int32_t nanos;
+	const char *text;
+};
+
+// Whether a line starts an entry ("TIMESTAMP :: USER:"), and if so where its parts are
+bool parseEntryStart(const char *line, const char *end, EntryStart &entry)
+{
+	size_t ts_len = parseTimestamp(line, end, entry.seconds, entry.nanos);
+	entry.user = line + ts_len + 4;
+	if (ts_len == 0 || entry.user > end || memcmp(line + ts_len, " :: ", 4) != 0)
+		return false;
+	const char *colon = (const char *) memchr(entry.user, ':', end - entry.user);
+	if (colon == NULL || colon == entry.user)
+		return false;
+	entry.user_len = colon - entry.user;
+	entry.text = colon + 1;
+	return true;
+}
+
+// Add an entry, whose text ends at text_end, to a feed
+void addEntry(ParsedFeed &feed, const EntryStart &entry, const char *text_end)
+{
+	feed.offsets.push_back(feed.records.size());
+	feed.seconds.push_back(entry.seconds);
+	appendEntry(feed.records, entry.user, entry.user_len, entry.text, text_end - entry.text, entry.seconds, entry.nanos);
+}
+
+// Encode the entries of a legacy timeline file
+void parseTimeline(const char *data, size_t size, ParsedFeed &feed, MigrateStats &stats)
+{
+	const char *end = data + size;
+	EntryStart entry, next;
+	bool in_entry = false;
+	for (const char *line = data; line < end; )
+	{
+		const char *newline = (const char *) memchr(line, '\n', end - line);
+		const char *line_end = newline != NULL ? newline : end;
+		// (only lines starting with a digit can start an entry)
+		if (*line >= '0' && *line <= '9' && parseEntryStart(line, line_end, next))
+		{
+			// The entry being read ends here, its text without the newline ending the entry
+			if (in_entry)
+				addEntry(feed, entry, line - 1);
+			else
+				stats.stray_bytes += line - data;
+			entry = next;
+			in_entry = true;
+		}
+		line = line_end + 1;
+	}
+	if (in_entry)
+		addEntry(feed, entry, end > entry.text && end[-1] == '\n' ? end - 1 : end);
+	else
+		stats.stray_bytes += size;
+}
+
+// Write a file under its temporary name
+bool writeTemporary(const string &path, const char *data, size_t len)
+{
+	int fd = open((path + MIGRATE_SUFFIX).c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0)
+		return false;
+	bool ok = writeAll(fd, data, len);
+	return close(fd) == 0 && ok;
+}
+
+bool renameTemporary(const string &path)
+{
+	return rename((path + MIGRATE_SUFFIX).c_str(), path.c_str()) == 0;
+}
+
+// Write a converted following feed: the cold tier (if any), the index, then the feed
+bool writeFollowingFeed(const string &path, const ParsedFeed &feed, const MigrateConfig &config, MigrateStats &stats)
+{
+	uint64_t posts = feed.offsets.size();
+	uint64_t blocks = config.hot_posts > 0 && posts > config.hot_posts ? (posts - config.hot_posts) / COLD_BLOCK_POSTS : 0;
+	uint64_t cold = blocks * COLD_BLOCK_POSTS;
+	uint64_t cut = cold < posts ? feed.offsets[cold] : feed.records.size();
+	string cold_path = coldPath(path), cdx_path = coldIndexPath(path);
+	bool ok = true;
+	if (blocks > 0)
+	{
+		string blocks_out, entries, compressed;
+		for (uint64_t b = 0; ok && b < blocks; b++)
+		{
+			uint64_t first = b * COLD_BLOCK_POSTS, last = first + COLD_BLOCK_POSTS;
+			uint64_t from = feed.offsets[first], to = last < posts ? feed.offsets[last] : feed.records.size();
+			ok = compressColdBlock(feed.records.data() + from, to - from, config.level, compressed);
+			ColdBlock block = {first + 1, blocks_out.size(), *max_element(feed.seconds.begin() + first, feed.seconds.begin() + last),
+				(uint32_t) compressed.size(), (uint32_t) (to - from), COLD_BLOCK_POSTS, COLD_CODEC_ZLIB};
+			char entry[COLD_ENTRY_SIZE];
+			encodeColdBlock(entry, block);
+			entries.append(entry, COLD_ENTRY_SIZE);
+			blocks_out += compressed;
+		}
+		ok = ok && writeTemporary(cold_path, blocks_out.data(), blocks_out.size())
+			&& writeTemporary(cdx_path, entries.data(), entries.size());
+		stats.bytes_out += blocks_out.size() + entries.size();
+		stats.cold_posts += cold;
+	}
+
+	// Post ids start at 1, the feed's at the first one left out of the cold tier
+	string index(INDEX_HEADER_SIZE + (posts - cold) * INDEX_ENTRY_SIZE, '\0');
+	encodeU64(&index[0], cold + 1);
+	for (uint64_t i = cold; i < posts; i++)
+		encodeU64(&index[INDEX_HEADER_SIZE + (i - cold) * INDEX_ENTRY_SIZE], feed.offsets[i] - cut);
+	ok = ok && writeTemporary(feedIndexPath(path), index.data(), index.size())
+		&& writeTemporary(path, feed.records.data() + cut, feed.records.size() - cut);
+	stats.bytes_out += index.size() + feed.records.size() - cut;
+
+	if (ok && blocks > 0)
+		ok = renameTemporary(cold_path) && renameTemporary(cdx_path);
+	else if (ok)
+	{
+		// (a cold tier left from an earlier conversion no longer belongs to the feed)
+		unlink(cold_path.c_str());
+		unlink(cdx_path.c_str());
+	}
+	return ok && renameTemporary(feedIndexPath(path)) && renameTemporary(path);
+}
+
+// Convert one .txt file
+void migrateFile(const string &txt_path, const MigrateConfig &config, ParsedFeed &feed, MigrateStats &stats)
+{
+	string path = txt_path.substr(0, txt_path.size() - 4) + ".dat";
+	bool following = endsWith(txt_path, "following.txt");
+	if (!config.force && access(path.c_str(), F_OK) == 0)
+	{
+		stats.existing++;
+		return;
+	}
+
+	int fd = open(txt_path.c_str(), O_RDONLY | O_CLOEXEC);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) < 0)
+	{
+		if (fd >= 0)
+			close(fd);
+		cerr << "tsmigrate: could not open " << txt_path << ": " << strerror(errno) << endl;
+		stats.failed++;
+		return;
+	}
+	feed.clear();
+	if (st.st_size > 0)
+	{
+		void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED)
+		{
+			close(fd);
+			cerr << "tsmigrate: could not map " << txt_path << ": " << strerror(errno) << endl;
+			stats.failed++;
+			return;
+		}
+		madvise(data, st.st_size, MADV_SEQUENTIAL);
+		// (records are about as long as the entries they come from)
+		feed.records.reserve(st.st_size + st.st_size / 8);
+		parseTimeline((const char *) data, st.st_size, feed, stats);
+		munmap(data, st.st_size);
+	}
+	close(fd);
+	stats.bytes_in += st.st_size;
+
+	// (an empty timeline converts to an empty feed, a file of something else is not touched)
+	if (feed.offsets.empty() && st.st_size > 0)
+	{
+		stats.not_timelines++;
+		return;
+	}
+	bool ok;
+	if (following)
+		ok = writeFollowingFeed(path, feed, config, stats);
+	else
+	{
+		ok = writeTemporary(path, feed.records.data(), feed.records.size()) && renameTemporary(path);
+		stats.bytes_out += feed.records.size();
+	}
+	if (!ok)
+	{
+		cerr << "tsmigrate: could not write the feed of " << txt_path << ": " << strerror(errno) << endl;
+		stats.failed++;
+		return;
+	}
+	stats.files++;
+	stats.posts += feed.offsets.size();
+}
+
+// The .txt files to convert, largest first
+vector<string> listInputs(const vector<string> &inputs)
+{
+	vector<pair<off_t, string>> files;
+	for (const string &input : inputs)
+	{
+		struct stat st;
+		if (stat(input.c_str(), &st) < 0)
+			killSession("Could not find " + input);
+		vector<string> paths;
+		if (S_ISDIR(st.st_mode))
+		{
+			DIR *dir = opendir(input.c_str());
+			if (dir == NULL)
+				killSession("Could not list " + input);
+			while (struct dirent *entry = readdir(dir))
+			{
+				string name = entry->d_name;
+				if (endsWith(name, ".txt"))
+					paths.push_back(input == "." ? name : input + "/" + name);
+			}
+			closedir(dir);
+		}
+		else if (endsWith(input, ".txt"))
+			paths.push_back(input);
+		else
+			killSession(input + " is neither a directory nor a .txt file");
+		for (const string &path : paths)
+			if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode))
+				files.push_back(make_pair(st.st_size, path));
+	}
+	sort(files.begin(), files.end(), [](const pair<off_t, string> &a, const pair<off_t, string> &b)
+	{
+		return a.first > b.first;
+	});
+	vector<string> paths;
+	for (const pair<off_t, string> &file : files)
+		paths.push_back(file.second);
+	return paths;
+}
+
+void usage()
+{
+	cerr << "usage: tsmigrate [-j threads] [-T hot posts (0: no cold tier)] [-Z compression level] [-f]\n"
+		 << "                 [directory or .txt file ...]\n";
+}
+
+int main(int argc, char **argv)
+{
+	MigrateConfig config;
+
+	int opt = 0;
+	while ((opt = getopt(argc, argv, "j:T:Z:f")) != -1)
+	{
+		switch (opt)
+		{
+		case 'j':
+			config.threads = max(0, atoi(optarg));
+			break;
+		case 'T':
+			config.hot_posts = max(0, atoi(optarg));
+			break;
+		case 'Z':
+			config.level = atoi(optarg);
+			break;
+		case 'f':
+			config.force = true;
+			break;
+		default:
+			usage();
+			return -1;
+		}
+	}
+	for (int i = optind; i < argc; i++)
+		config.inputs.push_back(argv[i]);
+	if (config.inputs.empty())
+		config.inputs.push_back(".");
+	if (config.level < Z_NO_COMPRESSION || config.level > Z_BEST_COMPRESSION)
+		killSession("Invalid compression level (-Z), expected 0 to 9");
+	if (config.threads == 0)
+		config.threads = max(1u, thread::hardware_concurrency());
+
+	// Workers take the next file until none are left
+	vector<string> files = listInputs(config.inputs);
+	MigrateStats stats;
+	atomic<size_t> next{0};
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	vector<thread> workers;
+	for (int i = 0; i < min<int>(config.threads, max<size_t>(files.size(), 1)); i++)
+		workers.emplace_back([&files, &next, &config, &stats]()
+		{
+			ParsedFeed feed;
+			for (size_t f = next++; f < files.size(); f = next++)
+				migrateFile(files[f], config, feed, stats);
+		});
+	for (thread &worker : workers)
+		worker.join();
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	cout << "Converted " << stats.files << " of " << files.size() << " files (" << stats.existing << " already converted, "
+		 << stats.not_timelines << " not timelines, " << stats.failed << " failed) with " << workers.size() << " threads\n"
+		 << " posts:      " << stats.posts << " (" << stats.cold_posts << " in cold tiers)\n"
+		 << " bytes:      " << stats.bytes_in << " read, " << stats.bytes_out << " written, " << stats.stray_bytes
+		 << " outside of entries\n"
+		 << " throughput: " << (seconds > 0 ? stats.bytes_in / seconds / 1e9 : 0) << " GB/s, "
+		 << (seconds > 0 ? stats.posts / seconds : 0) << " posts/s (" << seconds << " s)\n";
+	if (stats.existing > 0)
+		cout << "Feeds already converted were kept, '-f' converts them again" << endl;
+	return stats.failed > 0 ? 1 : 0;
+}
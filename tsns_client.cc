@@ -0,0 +1,714 @@
+/*
+ * libtsns_client - asynchronous Tiny SNS client (see tsns_client.h)
+ */
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cstring>
+#include <chrono>
+#include <deque>
+#include <random>
+#include <sstream>
+#include <thread>
+#include "tsns_client.h"
+
+using csce438::ListReply;
+using csce438::Message;
+using csce438::Reply;
+using csce438::Request;
+using csce438::SNSService;
+using csce438::TimelinePage;
+using csce438::TimelineRequest;
+using grpc::ClientContext;
+using grpc::Status;
+using grpc::WriteOptions;
+
+using namespace std;
+
+// Function to make a gRPC Message instance given a username and message string
+static Message MakeMessage(const string &username, const string &msg)
+{
+    Message m;
+    m.set_username(username);
+    m.set_msg(msg);
+    google::protobuf::Timestamp *timestamp = new google::protobuf::Timestamp();
+    timestamp->set_seconds(time(NULL));
+    timestamp->set_nanos(0);
+    m.set_allocated_timestamp(timestamp);
+    return m;
+}
+
+// Function to make the message that opens a timeline stream for a user
+static Message MakeStreamOpen(const string &username)
+{
+    Message m;
+    m.set_username(username);
+    m.set_open_stream(true);
+    return m;
+}
+
+// The "retry-after-ms" trailer of a call the server turned away, 0 if it has none
+static uint32_t retryAfterMs(const ClientContext &context)
+{
+    multimap<grpc::string_ref, grpc::string_ref>::const_iterator hint = context.GetServerTrailingMetadata().find("retry-after-ms");
+    if (hint == context.GetServerTrailingMetadata().end())
+        return 0;
+    return strtoul(string(hint->second.data(), hint->second.size()).c_str(), NULL, 10);
+}
+
+unsigned backoffMs(uint32_t retry_after_ms)
+{
+    static thread_local minstd_rand rng(random_device{}());
+    unsigned wait = retry_after_ms == 0 ? RETRY_DEFAULT_MS : min<uint32_t>(retry_after_ms, RETRY_MAX_MS);
+    return wait + rng() % (wait / 4 + 1);
+}
+
+// A unary call in flight, alive until its callback has run
+template <class Req, class Rep>
+struct UnaryCall
+{
+    ClientContext context;
+    Req request;
+    Rep reply;
+};
+
+// Start a unary call through the stub's callback API: start(context, request, reply, callback) issues it,
+// done(status, reply) runs on a gRPC thread once it completes
+template <class Req, class Rep, class Start, class Done>
+static void unaryCall(const Req &request, unsigned deadline_ms, Start start, Done done)
+{
+    shared_ptr<UnaryCall<Req, Rep>> call = make_shared<UnaryCall<Req, Rep>>();
+    call->request = request;
+    call->context.set_deadline(chrono::system_clock::now() + chrono::milliseconds(deadline_ms));
+    start(&call->context, &call->request, &call->reply, [call, done](Status status) { done(status, call->reply); });
+}
+
+SnsClient::SnsClient(const string &raddr, const string &p, const SnsClientOptions &options)
+    : port(p), options_(options)
+{
+    // A comma separated list of routers, "host" or "host:port" (the default port is the client port)
+    stringstream list(raddr);
+    string router;
+    while (getline(list, router, ','))
+    {
+        size_t colon = router.find(':');
+        if (colon == string::npos)
+            routers.push_back(make_pair(router, port));
+        else
+            routers.push_back(make_pair(router.substr(0, colon), router.substr(colon + 1)));
+    }
+    if (routers.empty())
+        routers.push_back(make_pair(string("127.0.0.1"), port));
+}
+
+shared_ptr<SnsSession> SnsClient::session(const string &username)
+{
+    return make_shared<SnsSession>(*this, username);
+}
+
+// A router that is down or has no master yet (e.g. just restarted) is skipped
+string SnsClient::askRouters(string &replica)
+{
+    char buf[1024];
+    bool reached = false;
+    size_t first;
+    {
+        lock_guard<mutex> lock(mtx);
+        first = current_router;
+    }
+    for (size_t attempt = 0; attempt < routers.size(); attempt++)
+    {
+        size_t r = (first + attempt) % routers.size();
+        int sock;
+        struct sockaddr_in addr;
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(stoi(routers[r].second));
+
+        // Convert router address from text to binary form and store in the struct
+        if (inet_pton(AF_INET, routers[r].first.c_str(), &addr.sin_addr) <= 0)
+            continue;
+        if ((sock = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+            continue;
+
+        // Connect to the router and read the address of the available master
+        // (the router returns a single byte in the event that no master is available)
+        int status = -1;
+        if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+            status = read(sock, buf, sizeof(buf));
+        close(sock);
+        if (status <= 0)
+            continue;
+        reached = true;
+        if (status == 1)
+            continue;
+        {
+            lock_guard<mutex> lock(mtx);
+            current_router = r;
+        }
+        // The master's read replica, if it has one, follows the master's address and its terminator
+        size_t end = strnlen(buf, status);
+        replica = "";
+        if (end + 1 < (size_t) status)
+            replica = string(buf + end + 1, strnlen(buf + end + 1, status - end - 1));
+        // The router replies "ip" or "ip:port" (when the master serves clients on a different port)
+        string master(buf, end);
+        if (master.find(':') == string::npos)
+            master += ":" + port;
+        return master;
+    }
+    return reached ? "0" : "";
+}
+
+shared_ptr<SNSService::Stub> SnsClient::stub(const string &address)
+{
+    lock_guard<mutex> lock(mtx);
+    vector<shared_ptr<grpc::Channel>> &pool = channels[address];
+    if (pool.empty())
+    {
+        // Separate connections: channels with different arguments do not share one
+        for (unsigned i = 0; i < max(1u, options_.channels); i++)
+        {
+            grpc::ChannelArguments args;
+            args.SetInt("tsns.channel", i);
+            pool.push_back(grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args));
+        }
+    }
+    return shared_ptr<SNSService::Stub>(SNSService::NewStub(pool[next_channel++ % pool.size()]));
+}
+
+// The timeline stream of a session, on the callback API: one read is always outstanding and the
+// posts to send are written one at a time from an outbox (buffered while more are waiting, so
+// they go out together). It deletes itself when the call is done.
+class SnsSession::TimelineStream : public grpc::ClientBidiReactor<Message, Message>
+{
+    public:
+        TimelineStream(SnsSession *session, shared_ptr<SNSService::Stub> stub, const vector<shared_ptr<const Message>> &first)
+            : session(session), stub(stub), outbox(first.begin(), first.end())
+        {
+            // Send the call's metadata along with the first messages rather than on its own
+            context.set_initial_metadata_corked(true);
+        }
+
+        void start()
+        {
+            stub->async()->Timeline(&context, this);
+            // Held until the stream stops taking writes (detached from the session), so it stays alive meanwhile
+            AddHold();
+            StartRead(&incoming);
+            {
+                unique_lock<mutex> lock(mtx);
+                started = true;
+                kick(lock);
+            }
+            StartCall();
+        }
+
+        void write(const vector<shared_ptr<const Message>> &messages)
+        {
+            unique_lock<mutex> lock(mtx);
+            outbox.insert(outbox.end(), messages.begin(), messages.end());
+            kick(lock);
+        }
+
+        void cancel() { context.TryCancel(); }
+
+        void OnWriteDone(bool ok) override
+        {
+            unique_lock<mutex> lock(mtx);
+            writing = false;
+            // A failed write fails the stream, the posts stay with the session to be re-sent
+            if (ok)
+                kick(lock);
+        }
+
+        void OnReadDone(bool ok) override
+        {
+            if (!ok)
+            {
+                finish();
+                return;
+            }
+            // The master is handing over to a new process, move to it
+            if (incoming.reopen())
+            {
+                reopen = true;
+                context.TryCancel();
+                finish();
+                return;
+            }
+            session->received(incoming);
+            StartRead(&incoming);
+        }
+
+        void OnDone(const Status &status) override
+        {
+            session->streamDone(reopen, status, retryAfterMs(context));
+            delete this;
+        }
+
+    private:
+        // Start writing the next post, unless a write is in flight
+        void kick(unique_lock<mutex> &lock)
+        {
+            if (!started || writing || outbox.empty())
+                return;
+            current = outbox.front();
+            outbox.pop_front();
+            writing = true;
+            WriteOptions options;
+            if (!outbox.empty())
+                options.set_buffer_hint();
+            lock.unlock();
+            StartWrite(current.get(), options);
+        }
+
+        // Stop taking writes and let the call end
+        void finish()
+        {
+            session->detach(this);
+            RemoveHold();
+        }
+
+        SnsSession *session;
+        shared_ptr<SNSService::Stub> stub;
+        ClientContext context;
+        Message incoming;
+        bool reopen = false;
+
+        mutex mtx;
+        // (shared with the session's queue of posts awaiting acknowledgement, not copied)
+        deque<shared_ptr<const Message>> outbox;
+        shared_ptr<const Message> current;
+        bool started = false;
+        bool writing = false;
+};
+
+SnsSession::SnsSession(SnsClient &client, const string &username)
+    : client(client), username_(username)
+{
+    // Seed post sequence numbers from the clock so they keep increasing across client restarts
+    next_seq = chrono::duration_cast<chrono::microseconds>(
+        chrono::system_clock::now().time_since_epoch()).count();
+}
+
+SnsSession::~SnsSession()
+{
+    close();
+}
+
+SnsSession::ConnectResult SnsSession::connect()
+{
+    string replica;
+    string master = client.askRouters(replica);
+    if (master == "")
+        return NO_ROUTER;
+    if (master == "0")
+        return NO_MASTER;
+
+    bool moved, was_connected;
+    {
+        lock_guard<mutex> lock(mtx);
+        moved = master != master_;
+        was_connected = connected;
+        if (moved)
+            stub_ = client.stub(master);
+        // Read from the master's replica from now on (or stop if it no longer has one)
+        if (client.options().replica_reads && replica != replica_)
+        {
+            replica_stub_.reset();
+            if (!replica.empty())
+                replica_stub_ = client.stub(replica);
+            replica_ = replica;
+        }
+    }
+
+    // A master that was only slow to answer still has us logged in, and says so
+    // (one shedding load or rate limiting logins asks us to come back later)
+    CommandResult login_result = login().get();
+    for (int attempt = 1; retryLater(login_result.status) && attempt < LOGIN_ATTEMPTS; attempt++)
+    {
+        this_thread::sleep_for(chrono::milliseconds(backoffMs(login_result.retry_after_ms)));
+        login_result = login().get();
+    }
+    bool logged_in = login_result.status.ok()
+        && (login_result.msg != "Invalid Username" || (!moved && was_connected));
+
+    lock_guard<mutex> lock(mtx);
+    if (!logged_in)
+    {
+        // Look the master up again next time
+        master_ = "";
+        return LOGIN_FAILED;
+    }
+    master_ = master;
+    connected = true;
+    return moved && was_connected ? CONNECTED_NEW : CONNECTED_SAME;
+}
+
+string SnsSession::master()
+{
+    lock_guard<mutex> lock(mtx);
+    return master_;
+}
+
+// Run one of the RPCs answering with a Reply message (LOGIN/FOLLOW/UNFOLLOW)
+static future<CommandResult> commandCall(shared_ptr<SNSService::Stub> stub, const Request &request, unsigned deadline_ms,
+                                         void (SNSService::Stub::async::*method)(ClientContext *, const Request *, Reply *,
+                                                                                 function<void(Status)>))
+{
+    shared_ptr<promise<CommandResult>> result = make_shared<promise<CommandResult>>();
+    if (!stub)
+    {
+        CommandResult failed;
+        failed.status = Status(grpc::StatusCode::UNAVAILABLE, "Not connected");
+        result->set_value(failed);
+        return result->get_future();
+    }
+    // (the retry hint is read off the call's context as it completes)
+    shared_ptr<uint32_t> retry_after_ms = make_shared<uint32_t>(0);
+    unaryCall<Request, Reply>(request, deadline_ms,
+        [stub, method, retry_after_ms](ClientContext *context, const Request *request, Reply *reply, function<void(Status)> done)
+        {
+            (stub->async()->*method)(context, request, reply, [context, retry_after_ms, done](Status status)
+            {
+                *retry_after_ms = retryAfterMs(*context);
+                done(status);
+            });
+        },
+        [result, retry_after_ms](const Status &status, const Reply &reply)
+        {
+            CommandResult r;
+            r.status = status;
+            r.msg = reply.msg();
+            r.retry_after_ms = *retry_after_ms;
+            result->set_value(r);
+        });
+    return result->get_future();
+}
+
+shared_ptr<SNSService::Stub> SnsSession::currentStub()
+{
+    lock_guard<mutex> lock(mtx);
+    return stub_;
+}
+
+future<CommandResult> SnsSession::login()
+{
+    Request request;
+    request.set_username(username_);
+    return commandCall(currentStub(), request, client.options().deadline_ms, &SNSService::Stub::async::Login);
+}
+
+future<CommandResult> SnsSession::follow(const string &username2)
+{
+    Request request;
+    request.set_username(username_);
+    request.add_arguments(username2);
+    return commandCall(currentStub(), request, client.options().deadline_ms, &SNSService::Stub::async::Follow);
+}
+
+future<CommandResult> SnsSession::unfollow(const string &username2)
+{
+    Request request;
+    request.set_username(username_);
+    request.add_arguments(username2);
+    return commandCall(currentStub(), request, client.options().deadline_ms, &SNSService::Stub::async::Unfollow);
+}
+
+// Ask the replica first if there is one, the master if it cannot answer (e.g. has not caught up with us yet)
+future<ListResult> SnsSession::list()
+{
+    shared_ptr<promise<ListResult>> result = make_shared<promise<ListResult>>();
+    shared_ptr<SNSService::Stub> stub, replica;
+    {
+        lock_guard<mutex> lock(mtx);
+        stub = stub_;
+        replica = replica_stub_;
+    }
+    Request request;
+    request.set_username(username_);
+    unsigned deadline_ms = client.options().deadline_ms;
+
+    function<void(const Status &, const ListReply &)> finish = [result](const Status &status, const ListReply &reply)
+    {
+        ListResult r;
+        r.status = status;
+        r.all_users.assign(reply.all_users().begin(), reply.all_users().end());
+        r.followers.assign(reply.followers().begin(), reply.followers().end());
+        result->set_value(r);
+    };
+    function<void()> ask_master = [=]()
+    {
+        if (!stub)
+        {
+            finish(Status(grpc::StatusCode::UNAVAILABLE, "Not connected"), ListReply());
+            return;
+        }
+        unaryCall<Request, ListReply>(request, deadline_ms,
+            [stub](ClientContext *context, const Request *request, ListReply *reply, function<void(Status)> done)
+            { stub->async()->List(context, request, reply, done); },
+            finish);
+    };
+    if (!replica)
+        ask_master();
+    else
+        unaryCall<Request, ListReply>(request, deadline_ms,
+            [replica](ClientContext *context, const Request *request, ListReply *reply, function<void(Status)> done)
+            { replica->async()->List(context, request, reply, done); },
+            [finish, ask_master](const Status &status, const ListReply &reply)
+            {
+                if (status.ok())
+                    finish(status, reply);
+                else
+                    ask_master();
+            });
+    return result->get_future();
+}
+
+future<HistoryResult> SnsSession::history(uint64_t before_post_id)
+{
+    shared_ptr<promise<HistoryResult>> result = make_shared<promise<HistoryResult>>();
+    shared_ptr<SNSService::Stub> stub, replica;
+    {
+        lock_guard<mutex> lock(mtx);
+        stub = stub_;
+        replica = replica_stub_;
+    }
+    TimelineRequest request;
+    request.set_username(username_);
+    request.set_before_post_id(before_post_id);
+    unsigned deadline_ms = client.options().deadline_ms;
+
+    function<void(const Status &, const TimelinePage &)> finish = [result](const Status &status, const TimelinePage &page)
+    {
+        HistoryResult r;
+        r.status = status;
+        r.posts.assign(page.posts().begin(), page.posts().end());
+        r.next_before_post_id = page.next_before_post_id();
+        result->set_value(r);
+    };
+    function<void()> ask_master = [=]()
+    {
+        if (!stub)
+        {
+            finish(Status(grpc::StatusCode::UNAVAILABLE, "Not connected"), TimelinePage());
+            return;
+        }
+        unaryCall<TimelineRequest, TimelinePage>(request, deadline_ms,
+            [stub](ClientContext *context, const TimelineRequest *request, TimelinePage *page, function<void(Status)> done)
+            { stub->async()->GetTimeline(context, request, page, done); },
+            finish);
+    };
+    if (!replica)
+        ask_master();
+    else
+        unaryCall<TimelineRequest, TimelinePage>(request, deadline_ms,
+            [replica](ClientContext *context, const TimelineRequest *request, TimelinePage *page, function<void(Status)> done)
+            { replica->async()->GetTimeline(context, request, page, done); },
+            [finish, ask_master](const Status &status, const TimelinePage &page)
+            {
+                if (status.ok())
+                    finish(status, page);
+                else
+                    ask_master();
+            });
+    return result->get_future();
+}
+
+future<Status> SnsSession::subscribe(function<void(const Message &)> callback, uint64_t since_post_id)
+{
+    shared_ptr<promise<Status>> done = make_shared<promise<Status>>();
+    TimelineStream *opened;
+    {
+        lock_guard<mutex> lock(mtx);
+        if (!stub_ || stream != NULL)
+        {
+            done->set_value(Status(grpc::StatusCode::FAILED_PRECONDITION,
+                                   stub_ ? "Already subscribed" : "Not connected"));
+            return done->get_future();
+        }
+        closing = false;
+        on_post = callback;
+        subscription = done;
+        last_post_id = since_post_id;
+        seen_posts.clear();
+        opened = openStream(false);
+    }
+    opened->start();
+    return done->get_future();
+}
+
+uint32_t SnsSession::streamRetryAfterMs()
+{
+    lock_guard<mutex> lock(mtx);
+    return stream_retry_after_ms;
+}
+
+// The stream opens with the stream opening message, then re-sends every post not acknowledged on the last one
+SnsSession::TimelineStream *SnsSession::openStream(bool reopen)
+{
+    shared_ptr<Message> open = make_shared<Message>(MakeStreamOpen(username_));
+    open->set_reopen(reopen);
+    open->set_post_id(last_post_id);
+    vector<shared_ptr<const Message>> first(1, open);
+    for (auto &pending : unacked)
+        first.push_back(pending.second.message);
+    vector<shared_ptr<const Message>> waited = sendWaiting();
+    first.insert(first.end(), waited.begin(), waited.end());
+    stream = new TimelineStream(this, stub_, first);
+    streams++;
+    return stream;
+}
+
+future<PublishResult> SnsSession::publish(const string &text)
+{
+    vector<future<PublishResult>> results = publish(vector<string>(1, text));
+    return move(results[0]);
+}
+
+vector<future<PublishResult>> SnsSession::publish(const vector<string> &texts)
+{
+    vector<future<PublishResult>> results;
+    lock_guard<mutex> lock(mtx);
+    for (const string &text : texts)
+    {
+        PendingPost pending;
+        pending.message = make_shared<Message>(MakeMessage(username_, text));
+        pending.result = make_shared<promise<PublishResult>>();
+        results.push_back(pending.result->get_future());
+        waiting.push_back(pending);
+    }
+    vector<shared_ptr<const Message>> batch = sendWaiting();
+    if (stream != NULL && !batch.empty())
+        stream->write(batch);
+    return results;
+}
+
+// Posts sent without acknowledgement span fewer than MAX_UNACKED sequence numbers, so the master
+// can tell any of them that is re-sent from a new post
+vector<shared_ptr<const Message>> SnsSession::sendWaiting()
+{
+    vector<shared_ptr<const Message>> sent;
+    while (!waiting.empty() && (unacked.empty() || next_seq - unacked.begin()->first < MAX_UNACKED))
+    {
+        sent.push_back(sequence(waiting.front()));
+        waiting.pop_front();
+    }
+    return sent;
+}
+
+shared_ptr<const Message> SnsSession::sequence(PendingPost pending)
+{
+    uint64_t seq = next_seq++;
+    pending.message->set_seq(seq);
+    unacked[seq] = pending;
+    return pending.message;
+}
+
+size_t SnsSession::pending()
+{
+    lock_guard<mutex> lock(mtx);
+    return unacked.size() + waiting.size();
+}
+
+void SnsSession::close()
+{
+    map<uint64_t, PendingPost> dropped;
+    deque<PendingPost> dropped_waiting;
+    {
+        unique_lock<mutex> lock(mtx);
+        closing = true;
+        if (stream != NULL)
+            stream->cancel();
+        done_cv.wait(lock, [this]() { return streams == 0; });
+        dropped.swap(unacked);
+        dropped_waiting.swap(waiting);
+    }
+    for (auto &pending : dropped)
+        pending.second.result->set_value(PublishResult());
+    for (PendingPost &pending : dropped_waiting)
+        pending.result->set_value(PublishResult());
+}
+
+void SnsSession::received(const Message &m)
+{
+    // Acknowledgements retire our own queued posts, and so do posts the master turned away
+    // (a post too old for the master to tell whether it has it goes out again under a new seq),
+    // making room for the posts waiting to be sent
+    if (m.ack() != 0 || m.retry_after_ms() != 0 || m.resync_seq() != 0)
+    {
+        shared_ptr<promise<PublishResult>> result;
+        {
+            lock_guard<mutex> lock(mtx);
+            auto it = unacked.find(m.ack() != 0 ? m.ack() : m.seq());
+            if (it == unacked.end())
+                return;
+            PendingPost pending = it->second;
+            unacked.erase(it);
+            vector<shared_ptr<const Message>> batch;
+            if (m.ack() == 0 && m.resync_seq() != 0)
+            {
+                // (a copy: the stream may still be writing the old one)
+                next_seq = max(next_seq, m.resync_seq() + 1);
+                pending.message = make_shared<Message>(*pending.message);
+                batch.push_back(sequence(pending));
+            }
+            else
+                result = pending.result;
+            vector<shared_ptr<const Message>> waited = sendWaiting();
+            batch.insert(batch.end(), waited.begin(), waited.end());
+            if (stream != NULL && !batch.empty())
+                stream->write(batch);
+            if (!result)
+                return;
+        }
+        PublishResult r;
+        r.accepted = m.ack() != 0;
+        r.retry_after_ms = m.retry_after_ms();
+        result->set_value(r);
+        return;
+    }
+    if (m.post_id() != 0)
+    {
+        lock_guard<mutex> lock(mtx);
+        if (!seen_posts.insert(m.post_id()).second)
+            return;
+        if (seen_posts.size() > SEEN_POSTS)
+            seen_posts.erase(seen_posts.begin());
+    }
+    uint64_t newest = last_post_id;
+    while (m.post_id() > newest && !last_post_id.compare_exchange_weak(newest, m.post_id()));
+    if (on_post)
+        on_post(m);
+}
+
+void SnsSession::detach(TimelineStream *done)
+{
+    lock_guard<mutex> lock(mtx);
+    if (stream == done)
+        stream = NULL;
+}
+
+void SnsSession::streamDone(bool reopen, const Status &status, uint32_t retry_after_ms)
+{
+    unique_lock<mutex> lock(mtx);
+    streams--;
+    stream_retry_after_ms = retry_after_ms;
+    // A hot restart: open the stream again on the same address, where the new process serves it
+    if (reopen && !closing)
+    {
+        TimelineStream *opened = openStream(true);
+        lock.unlock();
+        opened->start();
+        return;
+    }
+    shared_ptr<promise<Status>> done = subscription;
+    subscription.reset();
+    // (close() may destroy the session as soon as the lock is released)
+    done_cv.notify_all();
+    lock.unlock();
+    if (done)
+        done->set_value(status);
+}
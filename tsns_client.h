@@ -0,0 +1,258 @@
+#ifndef TSNS_CLIENT_H
+#define TSNS_CLIENT_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include <grpc++/grpc++.h>
+
+#include "sns.grpc.pb.h"
+
+/*
+ * Tiny SNS client library (libtsns_client.a), what tsc is built on.
+ *
+ * An SnsClient knows the routers and keeps a few channels (connections) to
+ * each master, which all of its sessions share; an SnsSession is one logged
+ * in user. Commands return futures and never block the caller, every call
+ * runs on gRPC's callback threads, so one process can drive thousands of
+ * users over a handful of connections:
+ *
+ *     SnsClient client("127.0.0.1", "3010");
+ *     std::shared_ptr<SnsSession> alice = client.session("alice");
+ *     if (alice->connect() < SnsSession::CONNECTED_SAME) ...
+ *     std::future<ListResult> users = alice->list();
+ *     std::future<grpc::Status> timeline = alice->subscribe([](const csce438::Message &post) { ... });
+ *     std::future<PublishResult> post = alice->publish("hello");
+ *
+ * connect() is the only blocking call: it asks the routers for the master
+ * and logs in, waiting as asked and trying again when the master turns the
+ * login away (retryLater()). A session keeps its master until a call fails in a way
+ * sessionLost() recognizes; it is then up to the caller to connect() again
+ * and retry (FOLLOW and UNFOLLOW are not idempotent).
+ *
+ * Posts are published on the user's timeline stream. They stay queued until
+ * the master acknowledges them and are re-sent when the stream is opened
+ * again (the master drops the ones it has already seen), so a post's future
+ * only resolves once it is on the master, or turned away by its rate limit.
+ * A post is only sent once it is within MAX_UNACKED sequence numbers of the
+ * oldest one awaiting acknowledgement.
+ * A master handing over in a hot restart is followed transparently.
+ */
+
+// Default deadline of every unary call
+#define RPC_DEADLINE_MS 2000
+
+// Span of sequence numbers a session has on its stream awaiting acknowledgement, at most the 64 the
+// master remembers to drop re-sent posts (later posts wait for the oldest to be acknowledged)
+#define MAX_UNACKED 64
+
+// Logins connect() makes while the master turns them away (RESOURCE_EXHAUSTED)
+#define LOGIN_ATTEMPTS 8
+
+// Wait before retrying a call turned away without a retry hint, and the longest wait whatever the hint
+#define RETRY_DEFAULT_MS 100
+#define RETRY_MAX_MS 5000
+
+// Newest post ids a session remembers, to drop a post delivered live while the stream was opening that the
+// master's replay has too (the replay is at most 20 posts)
+#define SEEN_POSTS 256
+
+struct SnsClientOptions
+{
+    unsigned channels = 1;              // Connections to each master, shared by all sessions
+    unsigned deadline_ms = RPC_DEADLINE_MS;
+    bool replica_reads = false;         // Send LIST and HISTORY to the master's read replica first
+};
+
+// Outcome of LOGIN, FOLLOW and UNFOLLOW: the server answers with a message
+struct CommandResult
+{
+    grpc::Status status;
+    std::string msg;
+    uint32_t retry_after_ms = 0;        // The master's retry hint when it turned the call away
+};
+
+struct ListResult
+{
+    grpc::Status status;
+    std::vector<std::string> all_users;
+    std::vector<std::string> followers;
+};
+
+struct HistoryResult
+{
+    grpc::Status status;
+    std::vector<csce438::Message> posts;
+    uint64_t next_before_post_id = 0;   // 0 on the last page
+};
+
+struct PublishResult
+{
+    bool accepted = false;
+    uint32_t retry_after_ms = 0;        // Set when the master's rate limit turned the post away
+};
+
+// Whether a failed call means the session has to connect() again: the master is down or hung,
+// or no longer knows the user (it was restarted)
+inline bool sessionLost(const grpc::Status &status)
+{
+    return status.error_code() == grpc::StatusCode::UNAVAILABLE
+        || status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED
+        || status.error_code() == grpc::StatusCode::NOT_FOUND;
+}
+
+// Whether a failed call (or stream) was turned away by the master's admission control or a rate limit,
+// and should be made again once its retry hint has passed (see backoffMs())
+inline bool retryLater(const grpc::Status &status)
+{
+    return status.error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED;
+}
+
+// How long to wait on a retry hint before trying again: the hint (RETRY_DEFAULT_MS without one) capped
+// at RETRY_MAX_MS, plus up to a quarter more at random so clients turned away together come back apart
+unsigned backoffMs(uint32_t retry_after_ms);
+
+class SnsSession;
+
+class SnsClient
+{
+    public:
+        // routers: a comma separated list, "host" or "host:port" (the default port is port)
+        SnsClient(const std::string &routers, const std::string &port,
+                  const SnsClientOptions &options = SnsClientOptions());
+
+        // A session for a user, not connected yet (the client must outlive its sessions)
+        std::shared_ptr<SnsSession> session(const std::string &username);
+
+        const SnsClientOptions &options() const { return options_; }
+
+    private:
+        friend class SnsSession;
+
+        // Ask the routers in turn for an available master, starting with the last one that answered
+        // Returns "ip:port" of the master (replica set to its read replica, if any),
+        // "" if no router is reachable and "0" if none has a master
+        std::string askRouters(std::string &replica);
+
+        // A stub on one of the channels to an address, handed out in turn
+        std::shared_ptr<csce438::SNSService::Stub> stub(const std::string &address);
+
+        std::vector<std::pair<std::string, std::string>> routers;
+        const std::string port;
+        const SnsClientOptions options_;
+
+        std::mutex mtx;
+        size_t current_router = 0;
+        std::map<std::string, std::vector<std::shared_ptr<grpc::Channel>>> channels;
+        size_t next_channel = 0;
+};
+
+class SnsSession
+{
+    public:
+        enum ConnectResult
+        {
+            NO_ROUTER,          // No router could be reached
+            NO_MASTER,          // The routers have no master available
+            LOGIN_FAILED,
+            CONNECTED_SAME,     // Still (or again) on the same master
+            CONNECTED_NEW       // Logged in on a different master
+        };
+
+        SnsSession(SnsClient &client, const std::string &username);
+        ~SnsSession();
+
+        // Look up the master and log in on it (again, even on the same master: one that stopped
+        // answering may have been restarted without us); blocks
+        ConnectResult connect();
+
+        // The master's "ip:port", "" before connecting
+        std::string master();
+        const std::string &username() const { return username_; }
+
+        std::future<CommandResult> login();
+        std::future<CommandResult> follow(const std::string &username2);
+        std::future<CommandResult> unfollow(const std::string &username2);
+        std::future<ListResult> list();
+        // A page of the followed users' posts older than before_post_id (0 for the newest)
+        std::future<HistoryResult> history(uint64_t before_post_id);
+
+        // Open the timeline stream, calling on_post (on a gRPC thread) for every post of the users followed
+        // The master first replays its newest posts, only those after since_post_id if the caller already
+        // has the posts up to it (e.g. cached from an earlier stream to the same master)
+        // Resolves when the stream is lost; connect() and subscribe again to carry on (after
+        // backoffMs(streamRetryAfterMs()) if the master turned the stream away, see retryLater())
+        std::future<grpc::Status> subscribe(std::function<void(const csce438::Message &)> on_post,
+                                            uint64_t since_post_id = 0);
+        // The retry hint of the last stream the master turned away, 0 if it did not give one
+        uint32_t streamRetryAfterMs();
+        // Publish posts (written together, as one batch), each resolving once the master has it
+        // Posts published while there is no stream wait for the next one
+        std::future<PublishResult> publish(const std::string &text);
+        std::vector<std::future<PublishResult>> publish(const std::vector<std::string> &texts);
+        // Posts not acknowledged yet
+        size_t pending();
+
+        // Close the timeline stream, dropping the posts not acknowledged yet
+        void close();
+
+    private:
+        class TimelineStream;
+
+        struct PendingPost
+        {
+            // (its seq is given when it is sent, and not changed once the stream has it)
+            std::shared_ptr<csce438::Message> message;
+            std::shared_ptr<std::promise<PublishResult>> result;
+        };
+
+        std::shared_ptr<csce438::SNSService::Stub> currentStub();
+        // Start a stream on the master, replaying the posts after last_post_id
+        // (the caller holds mtx, then calls start() on it without)
+        TimelineStream *openStream(bool reopen);
+        // Give the posts waiting to be sent a seq while they fit in the MAX_UNACKED span, returning them
+        // (the caller holds mtx, and writes them to the stream)
+        std::vector<std::shared_ptr<const csce438::Message>> sendWaiting();
+        // Queue a post awaiting acknowledgement under a new seq
+        std::shared_ptr<const csce438::Message> sequence(PendingPost pending);
+        // Called by the stream
+        void received(const csce438::Message &message);
+        void detach(TimelineStream *stream);
+        void streamDone(bool reopen, const grpc::Status &status, uint32_t retry_after_ms);
+
+        SnsClient &client;
+        const std::string username_;
+
+        std::mutex mtx;
+        std::string master_;
+        bool connected = false;
+        std::shared_ptr<csce438::SNSService::Stub> stub_;
+        std::string replica_;
+        std::shared_ptr<csce438::SNSService::Stub> replica_stub_;
+
+        // Timeline stream state (guarded by mtx)
+        TimelineStream *stream = NULL;
+        int streams = 0;        // Started and not done yet
+        bool closing = false;
+        std::condition_variable done_cv;
+        std::function<void(const csce438::Message &)> on_post;
+        std::shared_ptr<std::promise<grpc::Status>> subscription;
+        uint64_t next_seq;
+        uint32_t stream_retry_after_ms = 0;
+        std::map<uint64_t, PendingPost> unacked;
+        std::deque<PendingPost> waiting;       // Published, not sent yet
+        // Newest timeline post received (or already had), so a reopened stream only replays the posts missed while moving
+        std::atomic<uint64_t> last_post_id{0};
+        std::set<uint64_t> seen_posts;
+};
+
+#endif
@@ -0,0 +1,515 @@
+/*
+ * tsreplay - replay a master's traffic capture against a server
+ *
+ * Reads a capture recorded with 'tsdm -C FILE' and sends the same requests
+ * and timeline stream messages to the master a router names (or the one
+ * given directly), at the captured pace, N times faster or as fast as it
+ * goes. Reports, per kind of request, the time the captured master took next
+ * to the latency seen in the replay, so a workload recorded once can be run
+ * against every new build.
+ *
+ * Requests that overlapped in the capture overlap in the replay, but one is
+ * only sent once every request that had completed before it arrived in the
+ * capture has completed in the replay (a LOGIN before the user's FOLLOWs and
+ * stream, a FOLLOW before the posts the follower should see). A stream's
+ * messages are written in order on one stream of their own.
+ */
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpc++/grpc++.h>
+
+#include "capture.h"
+#include "histogram.h"
+#include "sns.grpc.pb.h"
+
+using csce438::ListReply;
+using csce438::Message;
+using csce438::Reply;
+using csce438::Request;
+using csce438::SNSService;
+using csce438::TimelinePage;
+using csce438::TimelineRequest;
+using grpc::ChannelArguments;
+using grpc::ClientContext;
+using grpc::ClientReaderWriter;
+using grpc::Status;
+
+using namespace std;
+
+typedef chrono::steady_clock Clock;
+
+// Deadline of every replayed unary call
+#define REPLAY_DEADLINE_MS 10000
+
+struct ReplayConfig
+{
+	string capture_path = "";
+	string router_addr = "127.0.0.1";
+	string router_port = "3010";
+	string master = "";
+	double speed = 1;		// 0 replays as fast as possible
+	int channels = 4;
+};
+
+// Kinds of request reported on, stream messages split into the one opening the stream and posts
+enum ReplayKind { LOGIN, FOLLOW, UNFOLLOW, LIST, GET_TIMELINE, STREAM_OPEN, POST, NUM_KINDS };
+const char *kind_names[NUM_KINDS] = { "login", "follow", "unfollow", "list", "get_timeline", "stream_open", "post" };
+
+struct ReplayOp
+{
+	CaptureRecord record;
+	Message message;	// Parsed payload of stream messages
+	size_t rank;		// Position among all ops ordered by when they completed in the capture
+	size_t after;		// Number of ops (in that order) that completed before this one arrived
+};
+
+// Completion of ops in the replay, in the captured completion order
+class Progress
+{
+	public:
+		explicit Progress(size_t ops) : done(ops, false) {}
+
+		void complete(size_t rank)
+		{
+			lock_guard<mutex> lock(mtx);
+			done[rank] = true;
+			while (prefix < done.size() && done[prefix])
+				prefix++;
+			cv.notify_all();
+		}
+
+		// Wait until the first count ops have all completed
+		void waitFor(size_t count)
+		{
+			unique_lock<mutex> lock(mtx);
+			cv.wait(lock, [this, count]() { return prefix >= count; });
+		}
+
+	private:
+		mutex mtx;
+		condition_variable cv;
+		vector<bool> done;
+		size_t prefix = 0;
+};
+
+// Latency per kind of request, captured and replayed
+struct ReplayStats
+{
+	mutex mtx;
+	LatencyHistogram captured[NUM_KINDS];
+	LatencyHistogram replayed[NUM_KINDS];
+	atomic<uint64_t> errors{0}, rejected{0}, delivered{0};
+
+	void record(ReplayKind kind, int64_t ns)
+	{
+		lock_guard<mutex> lock(mtx);
+		replayed[kind].record(max<int64_t>(0, ns));
+	}
+};
+
+// One captured timeline stream, replayed by a writer thread (and a reader for the master's messages)
+struct ReplayStream
+{
+	SNSService::Stub *stub;
+	ClientContext context;
+	unique_ptr<ClientReaderWriter<Message, Message>> stream;
+	thread writer, reader;
+	atomic<bool> read_all{false};
+
+	mutex mtx;
+	condition_variable cv;
+	deque<ReplayOp *> queue;
+	bool finished = false;				// No more ops will be queued
+	map<uint64_t, Clock::time_point> awaiting;	// Posts written and not acknowledged yet, by seq
+};
+
+// Exit the process with a message in the event of a fatal error
+void killSession(string error)
+{
+	cerr << "\nREPLAY ERROR: " << error << endl;
+	cerr << "Replay shutting down..." << endl;
+	exit(EXIT_FAILURE);
+}
+
+// Ask the router for the available master, returns "" if there is none (or the router is unreachable)
+string askRouter(const string &router_addr, const string &router_port)
+{
+	int sock;
+	struct sockaddr_in addr;
+	char buf[1024];
+
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(stoi(router_port));
+	if (inet_pton(AF_INET, router_addr.c_str(), &addr.sin_addr) <= 0)
+		killSession("Invalid router address in askRouter()");
+
+	if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+		killSession("Socket error in askRouter()");
+
+	int status = -1;
+	if (connect(sock, (struct sockaddr *) &addr, sizeof(addr)) == 0)
+		status = read(sock, buf, sizeof(buf));
+	close(sock);
+
+	// A single byte means no master is available
+	if (status <= 1)
+		return "";
+	string master(buf, strnlen(buf, status));
+	if (master.find(':') == string::npos)
+		master += ":" + router_port;
+	return master;
+}
+
+// Send a stream's messages as they are queued, then close it
+void writeStream(ReplayStream *s, Progress &progress, ReplayStats &stats)
+{
+	bool open = true;
+	while (true)
+	{
+		ReplayOp *op;
+		{
+			unique_lock<mutex> lock(s->mtx);
+			s->cv.wait(lock, [s]() { return s->finished || !s->queue.empty(); });
+			if (s->queue.empty())
+				break;
+			op = s->queue.front();
+			s->queue.pop_front();
+		}
+		if (op->record.kind == CAPTURE_STREAM_END)
+		{
+			if (open)
+				s->stream->WritesDone();
+			open = false;
+		}
+		else if (open)
+		{
+			Clock::time_point sent = Clock::now();
+			if (op->message.seq() != 0 && !op->message.open_stream())
+			{
+				lock_guard<mutex> lock(s->mtx);
+				s->awaiting[op->message.seq()] = sent;
+			}
+			if (!s->stream->Write(op->message))
+			{
+				stats.errors++;
+				open = false;
+			}
+		}
+		// Later messages of the stream are ordered by the stream itself, so a message is done once written
+		progress.complete(op->rank);
+	}
+	if (open)
+		s->stream->WritesDone();
+}
+
+// Time the master's acknowledgements of posts and count the posts delivered
+void readStream(ReplayStream *s, ReplayStats &stats)
+{
+	Message m;
+	while (s->stream->Read(&m))
+	{
+		bool turned_away = m.retry_after_ms() != 0 || m.resync_seq() != 0;
+		uint64_t seq = m.ack() != 0 ? m.ack() : (turned_away ? m.seq() : 0);
+		if (seq == 0)
+		{
+			if (!m.reopen())
+				stats.delivered++;
+			continue;
+		}
+		if (turned_away)
+			stats.rejected++;
+		lock_guard<mutex> lock(s->mtx);
+		map<uint64_t, Clock::time_point>::iterator it = s->awaiting.find(seq);
+		if (it == s->awaiting.end())
+			continue;
+		stats.record(POST, chrono::duration_cast<chrono::nanoseconds>(Clock::now() - it->second).count());
+		s->awaiting.erase(it);
+	}
+	s->stream->Finish();
+	s->read_all = true;
+}
+
+// Send a unary request through the stub's callback API, completing the op once answered
+template <class Req, class Rep, class Start>
+void unaryCall(const string &payload, ReplayKind kind, size_t rank, Progress &progress, ReplayStats &stats, Start start)
+{
+	struct Call
+	{
+		ClientContext context;
+		Req request;
+		Rep reply;
+		Clock::time_point sent;
+	};
+	shared_ptr<Call> call = make_shared<Call>();
+	if (!call->request.ParseFromString(payload))
+	{
+		stats.errors++;
+		progress.complete(rank);
+		return;
+	}
+	call->context.set_deadline(chrono::system_clock::now() + chrono::milliseconds(REPLAY_DEADLINE_MS));
+	call->sent = Clock::now();
+	start(&call->context, &call->request, &call->reply, [call, kind, rank, &progress, &stats](Status status)
+	{
+		stats.record(kind, chrono::duration_cast<chrono::nanoseconds>(Clock::now() - call->sent).count());
+		if (status.error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED)
+			stats.rejected++;
+		else if (!status.ok())
+			stats.errors++;
+		progress.complete(rank);
+	});
+}
+
+// Signed difference of two durations, e.g. "+1.25ms" or "-40.00us"
+string formatDelta(uint64_t replayed, uint64_t captured)
+{
+	return (replayed >= captured ? "+" : "-") + formatNanos(replayed >= captured ? replayed - captured : captured - replayed);
+}
+
+void usage()
+{
+	cerr << "usage: tsreplay -f capture [-x speed (0: as fast as possible)] [-a router address] [-p router port]\n"
+		 << "                [-m master ip:port] [-c channels]\n";
+}
+
+int main(int argc, char **argv)
+{
+	ReplayConfig config;
+
+	int opt = 0;
+	while ((opt = getopt(argc, argv, "f:x:a:p:m:c:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'f':
+			config.capture_path = optarg;
+			break;
+		case 'x':
+			config.speed = max(0.0, atof(optarg));
+			break;
+		case 'a':
+			config.router_addr = optarg;
+			break;
+		case 'p':
+			config.router_port = optarg;
+			break;
+		case 'm':
+			config.master = optarg;
+			break;
+		case 'c':
+			config.channels = max(1, atoi(optarg));
+			break;
+		default:
+			usage();
+			return -1;
+		}
+	}
+	if (config.capture_path == "")
+	{
+		usage();
+		return -1;
+	}
+
+	// Load the capture, then order it by arrival and work out what each op waits for
+	CaptureReader reader;
+	if (!reader.open(config.capture_path))
+		killSession("Could not read capture " + config.capture_path);
+	vector<ReplayOp> ops;
+	CaptureRecord record;
+	while (reader.next(record))
+	{
+		ReplayOp op;
+		op.record = record;
+		if (record.kind == CAPTURE_STREAM_MESSAGE && !op.message.ParseFromString(record.payload))
+			killSession("Corrupt stream message in capture");
+		ops.push_back(op);
+	}
+	if (ops.empty())
+		killSession("Capture " + config.capture_path + " holds no requests");
+	stable_sort(ops.begin(), ops.end(), [](const ReplayOp &a, const ReplayOp &b)
+	{
+		return a.record.arrival_ns < b.record.arrival_ns;
+	});
+	vector<pair<int64_t, size_t>> completions;
+	for (size_t i = 0; i < ops.size(); i++)
+		completions.push_back(make_pair(ops[i].record.arrival_ns + ops[i].record.handling_ns, i));
+	sort(completions.begin(), completions.end());
+	for (size_t r = 0; r < completions.size(); r++)
+		ops[completions[r].second].rank = r;
+	for (ReplayOp &op : ops)
+		op.after = lower_bound(completions.begin(), completions.end(), make_pair(op.record.arrival_ns, (size_t) 0)) - completions.begin();
+
+	ReplayStats stats;
+	for (ReplayOp &op : ops)
+	{
+		ReplayKind kind;
+		switch (op.record.kind)
+		{
+		case CAPTURE_LOGIN: kind = LOGIN; break;
+		case CAPTURE_FOLLOW: kind = FOLLOW; break;
+		case CAPTURE_UNFOLLOW: kind = UNFOLLOW; break;
+		case CAPTURE_LIST: kind = LIST; break;
+		case CAPTURE_GET_TIMELINE: kind = GET_TIMELINE; break;
+		case CAPTURE_STREAM_MESSAGE: kind = op.message.open_stream() ? STREAM_OPEN : POST; break;
+		default: continue;
+		}
+		stats.captured[kind].record(op.record.handling_ns);
+	}
+	int64_t first_arrival = ops.front().record.arrival_ns;
+	double captured_seconds = (ops.back().record.arrival_ns - first_arrival) / 1e9;
+	cout << "Loaded " << ops.size() << " requests spanning " << captured_seconds << "s from " << config.capture_path << endl;
+
+	if (config.master == "")
+		config.master = askRouter(config.router_addr, config.router_port);
+	if (config.master == "")
+		killSession("No master available from the router");
+	cout << "Replaying against master " << config.master;
+	if (config.speed > 0)
+		cout << " at " << config.speed << "x" << endl;
+	else
+		cout << " as fast as possible" << endl;
+
+	// Spread the requests over a few separate connections
+	vector<unique_ptr<SNSService::Stub>> stubs;
+	for (int i = 0; i < config.channels; i++)
+	{
+		ChannelArguments args;
+		args.SetInt("tsreplay.channel", i);
+		stubs.push_back(SNSService::NewStub(grpc::CreateCustomChannel(config.master, grpc::InsecureChannelCredentials(), args)));
+	}
+
+	// Issue every op at its time, once what it depends on is done; stream messages go to their stream's writer
+	Progress progress(ops.size());
+	map<uint64_t, unique_ptr<ReplayStream>> streams;
+	size_t next_stub = 0;
+	Clock::time_point replay_start = Clock::now();
+	for (ReplayOp &op : ops)
+	{
+		if (config.speed > 0)
+			this_thread::sleep_until(replay_start + chrono::nanoseconds((int64_t) ((op.record.arrival_ns - first_arrival) / config.speed)));
+		progress.waitFor(op.after);
+
+		SNSService::Stub *stub = stubs[next_stub++ % stubs.size()].get();
+		switch (op.record.kind)
+		{
+		case CAPTURE_LOGIN:
+			unaryCall<Request, Reply>(op.record.payload, LOGIN, op.rank, progress, stats,
+				[stub](ClientContext *c, const Request *q, Reply *r, function<void(Status)> done) { stub->async()->Login(c, q, r, done); });
+			break;
+		case CAPTURE_FOLLOW:
+			unaryCall<Request, Reply>(op.record.payload, FOLLOW, op.rank, progress, stats,
+				[stub](ClientContext *c, const Request *q, Reply *r, function<void(Status)> done) { stub->async()->Follow(c, q, r, done); });
+			break;
+		case CAPTURE_UNFOLLOW:
+			unaryCall<Request, Reply>(op.record.payload, UNFOLLOW, op.rank, progress, stats,
+				[stub](ClientContext *c, const Request *q, Reply *r, function<void(Status)> done) { stub->async()->Unfollow(c, q, r, done); });
+			break;
+		case CAPTURE_LIST:
+			unaryCall<Request, ListReply>(op.record.payload, LIST, op.rank, progress, stats,
+				[stub](ClientContext *c, const Request *q, ListReply *r, function<void(Status)> done) { stub->async()->List(c, q, r, done); });
+			break;
+		case CAPTURE_GET_TIMELINE:
+			unaryCall<TimelineRequest, TimelinePage>(op.record.payload, GET_TIMELINE, op.rank, progress, stats,
+				[stub](ClientContext *c, const TimelineRequest *q, TimelinePage *r, function<void(Status)> done) { stub->async()->GetTimeline(c, q, r, done); });
+			break;
+		case CAPTURE_STREAM_MESSAGE:
+		case CAPTURE_STREAM_END:
+		{
+			unique_ptr<ReplayStream> &s = streams[op.record.stream];
+			if (!s)
+			{
+				// A stream whose start was not captured only has its end left
+				if (op.record.kind == CAPTURE_STREAM_END)
+				{
+					progress.complete(op.rank);
+					break;
+				}
+				s.reset(new ReplayStream());
+				s->stub = stub;
+				s->stream = s->stub->Timeline(&s->context);
+				ReplayStream *p = s.get();
+				s->reader = thread(readStream, p, ref(stats));
+				s->writer = thread(writeStream, p, ref(progress), ref(stats));
+			}
+			lock_guard<mutex> lock(s->mtx);
+			s->queue.push_back(&op);
+			s->cv.notify_one();
+			break;
+		}
+		default:
+			progress.complete(op.rank);
+		}
+	}
+	progress.waitFor(ops.size());
+	double replay_seconds = chrono::duration<double>(Clock::now() - replay_start).count();
+
+	// Close the streams still open at the end of the capture and let the last acknowledgements arrive
+	for (auto &entry : streams)
+	{
+		ReplayStream *s = entry.second.get();
+		{
+			lock_guard<mutex> lock(s->mtx);
+			s->finished = true;
+		}
+		s->cv.notify_one();
+		s->writer.join();
+	}
+	Clock::time_point give_up = Clock::now() + chrono::seconds(2);
+	for (auto &entry : streams)
+	{
+		while (!entry.second->read_all && Clock::now() < give_up)
+			this_thread::sleep_for(chrono::milliseconds(10));
+		entry.second->context.TryCancel();
+		entry.second->reader.join();
+	}
+
+	cout << "\n========= TSREPLAY RESULTS =========\n";
+	cout << " " << ops.size() << " requests on " << streams.size() << " streams, captured over " << captured_seconds
+		 << "s, replayed in " << replay_seconds << "s (" << ops.size() / replay_seconds << " requests/s)\n";
+	cout << " (captured: time the master took to handle a request; replayed: round trip,"
+		 << " for posts until the acknowledgement)\n";
+	for (int k = 0; k < NUM_KINDS; k++)
+	{
+		const LatencyHistogram &c = stats.captured[k], &r = stats.replayed[k];
+		if (c.count() == 0 && r.count() == 0)
+			continue;
+		cout << " " << kind_names[k] << ": " << c.count() << " captured, p50 " << formatNanos(c.percentile(0.50))
+			 << ", p99 " << formatNanos(c.percentile(0.99));
+		// Opening a stream is not answered, so it is not timed in the replay
+		if (r.count() != 0)
+			cout << "; " << r.count() << " replayed, p50 " << formatNanos(r.percentile(0.50))
+				 << ", p99 " << formatNanos(r.percentile(0.99))
+				 << "; delta p50 " << formatDelta(r.percentile(0.50), c.percentile(0.50))
+				 << ", p99 " << formatDelta(r.percentile(0.99), c.percentile(0.99));
+		cout << "\n";
+	}
+	cout << " deliveries:        " << stats.delivered << "\n";
+	cout << " rejected:          " << stats.rejected << "\n";
+	cout << " errors:            " << stats.errors << "\n";
+	cout << "====================================\n";
+
+	// One machine-readable line for tracking results between builds
+	cout << "tsreplay-result replay_seconds=" << replay_seconds << " requests_per_sec=" << ops.size() / replay_seconds;
+	for (int k = 0; k < NUM_KINDS; k++)
+		if (stats.replayed[k].count() != 0)
+			cout << " " << kind_names[k] << "_p99_us=" << stats.replayed[k].percentile(0.99) / 1000
+				 << " " << kind_names[k] << "_captured_p99_us=" << stats.captured[k].percentile(0.99) / 1000;
+	cout << " rejected=" << stats.rejected << " errors=" << stats.errors << endl;
+	return 0;
+}